@@ -0,0 +1,32 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_BENCHMARKS_TIMING_HPP_
+#define LIBPERM_BENCHMARKS_TIMING_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+/**
+ * Runs the given function the given amount of times and returns the fastest of the measured runtimes (in
+ * milliseconds).
+ */
+template< typename Func > double fastestRuntime(std::size_t repetitions, Func &&func) {
+	double fastest = std::numeric_limits< double >::max();
+
+	for (std::size_t i = 0; i < repetitions; ++i) {
+		const auto start = std::chrono::steady_clock::now();
+		func();
+		const auto end = std::chrono::steady_clock::now();
+
+		fastest = std::min(fastest, std::chrono::duration< double, std::milli >(end - start).count());
+	}
+
+	return fastest;
+}
+
+#endif // LIBPERM_BENCHMARKS_TIMING_HPP_
@@ -0,0 +1,61 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "Timing.hpp"
+
+#include <libperm/Cycle.hpp>
+#include <libperm/DiminoAlgorithm.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/PrimitivePermutationGroup.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/*
+ * Measures the speedup of generating the elements of the symmetric group Sym(n) via Dimino's algorithm, when filling
+ * the cosets with multiple threads. Usage: dimino_threads [n]
+ */
+int main(int argc, char **argv) {
+	const perm::AbstractPermutation::value_type n =
+		argc > 1 ? static_cast< perm::AbstractPermutation::value_type >(std::atoi(argv[1])) : 9;
+
+	// Adjacent transpositions make Dimino build up the group via a chain of ever-bigger symmetric groups, which
+	// results in big cosets in the final extension steps
+	std::vector< perm::Permutation > generators;
+	for (perm::AbstractPermutation::value_type i = 0; i + 1 < n; ++i) {
+		generators.push_back(perm::ExplicitPermutation(perm::Cycle({ i, i + 1 })));
+	}
+
+	std::size_t order       = 0;
+	const double sequential = fastestRuntime(3, [&]() {
+		order = perm::DiminoAlgorithm::generateGroupElements(generators, 1).size();
+	});
+
+	std::cout << "Generating Sym(" << n << ") (" << order << " elements)\n";
+	std::cout << "threads\ttime [ms]\tspeedup\n";
+	std::cout << 1 << "\t" << sequential << "\t" << 1.0 << "\n";
+
+	for (std::size_t threadCount : { 2, 4, 8, 16, 32 }) {
+		const double parallel = fastestRuntime(3, [&]() {
+			perm::DiminoAlgorithm::generateGroupElements(generators, threadCount);
+		});
+
+		std::cout << threadCount << "\t" << parallel << "\t" << sequential / parallel << "\n";
+	}
+
+	// The same, but through the group API using as many threads as there are hardware threads
+	const double group = fastestRuntime(3, [&]() {
+		perm::PrimitivePermutationGroup symmetricGroup(generators);
+		symmetricGroup.setThreadCount(0);
+		symmetricGroup.order();
+	});
+
+	std::cout << "group (all hardware threads)\t" << group << "\t" << sequential / group << "\n";
+
+	return 0;
+}
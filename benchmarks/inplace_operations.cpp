@@ -0,0 +1,103 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "Timing.hpp"
+
+#include <libperm/Cycle.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+static std::atomic< std::size_t > allocationCount{ 0 };
+
+void *operator new(std::size_t size) {
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (void *memory = std::malloc(size == 0 ? 1 : size)) {
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+/**
+ * Runs the given operation the given amount of times (after a warm-up run) and reports the runtime and the amount of
+ * memory allocations per operation
+ */
+template< typename Func > void measure(const std::string &name, std::size_t iterations, Func &&func) {
+	// Warm up, so that all involved objects have reached their steady-state capacities
+	func();
+
+	std::size_t allocations = 0;
+	const double runtime    = fastestRuntime(3, [&]() {
+		const std::size_t before = allocationCount.load(std::memory_order_relaxed);
+
+		for (std::size_t i = 0; i < iterations; ++i) {
+			func();
+		}
+
+		allocations = allocationCount.load(std::memory_order_relaxed) - before;
+	});
+
+	std::cout << name << "\t" << runtime * 1e6 / static_cast< double >(iterations) << "\t"
+			  << static_cast< double >(allocations) / static_cast< double >(iterations) << "\n";
+}
+
+/*
+ * Measures the runtime and the amount of memory allocations of the in-place operations of ExplicitPermutation on
+ * permutations of n points. In steady state, none of them should allocate any memory.
+ * Usage: inplace_operations [n]
+ */
+int main(int argc, char **argv) {
+	const perm::AbstractPermutation::value_type n =
+		argc > 1 ? static_cast< perm::AbstractPermutation::value_type >(std::atoi(argv[1])) : 1000;
+
+	// A big cycle and a product of transpositions, both moving all n points
+	std::vector< perm::AbstractPermutation::value_type > cycle;
+	std::vector< std::vector< perm::AbstractPermutation::value_type > > transpositions;
+	for (perm::AbstractPermutation::value_type i = 0; i < n; ++i) {
+		cycle.push_back((i * 7) % n);
+
+		if (i % 2 == 1) {
+			transpositions.push_back({ i - 1, i });
+		}
+	}
+
+	const perm::ExplicitPermutation lhs{ perm::Cycle(cycle) };
+	const perm::ExplicitPermutation rhs{ perm::Cycle(transpositions) };
+
+	perm::ExplicitPermutation current     = lhs;
+	perm::ExplicitPermutation destination = lhs;
+
+	constexpr std::size_t iterations = 10000;
+
+	std::cout << "Operations on permutations of " << n << " points\n";
+	std::cout << "operation\ttime [ns]\tallocations\n";
+
+	measure("invert", iterations, [&]() { current.invert(); });
+	measure("preMultiply", iterations, [&]() { current.preMultiply(rhs); });
+	measure("postMultiply", iterations, [&]() { current.postMultiply(rhs); });
+	measure("selfMultiply", iterations, [&]() { current.postMultiply(current); });
+	measure("composeInto", iterations, [&]() { perm::composeInto(destination, lhs, rhs); });
+	measure("invertInto", iterations, [&]() { perm::invertInto(destination, lhs); });
+	measure("moveAssign", iterations, [&]() { destination = std::move(current); });
+
+	return 0;
+}
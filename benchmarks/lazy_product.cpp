@@ -0,0 +1,57 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "Timing.hpp"
+
+#include <libperm/Cycle.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/PermutationProduct.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/*
+ * Compares evaluating the product of four permutations on n points via chained operator* (which creates a temporary
+ * permutation per multiplication) with materializing the corresponding lazy product in a single pass.
+ * Usage: lazy_product [n]
+ */
+int main(int argc, char **argv) {
+	const perm::AbstractPermutation::value_type n =
+		argc > 1 ? static_cast< perm::AbstractPermutation::value_type >(std::atoi(argv[1])) : 1000;
+
+	std::vector< perm::ExplicitPermutation > factors;
+	for (perm::AbstractPermutation::value_type step : { 3, 5, 7, 11 }) {
+		std::vector< perm::AbstractPermutation::value_type > cycle;
+		for (perm::AbstractPermutation::value_type i = 0; i < n; ++i) {
+			cycle.push_back((i * step) % n);
+		}
+
+		factors.emplace_back(perm::Cycle(cycle));
+	}
+
+	constexpr std::size_t iterations = 1000;
+
+	perm::ExplicitPermutation result;
+	const double chained = fastestRuntime(3, [&]() {
+		for (std::size_t i = 0; i < iterations; ++i) {
+			result = factors[0] * factors[1] * factors[2] * factors[3];
+		}
+	});
+
+	const double lazy = fastestRuntime(3, [&]() {
+		for (std::size_t i = 0; i < iterations; ++i) {
+			perm::lazyProduct(factors[0], factors[1], factors[2], factors[3]).materializeInto(result);
+		}
+	});
+
+	std::cout << "Product of 4 permutations on " << n << " points\n";
+	std::cout << "method\ttime [us]\n";
+	std::cout << "chained\t" << chained * 1000 / iterations << "\n";
+	std::cout << "lazy\t" << lazy * 1000 / iterations << "\n";
+
+	return 0;
+}
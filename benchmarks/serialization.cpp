@@ -0,0 +1,74 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "Timing.hpp"
+
+#include <libperm/Cycle.hpp>
+#include <libperm/DiminoAlgorithm.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/Serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Measures the throughput of the compact binary serialization of permutations by encoding and decoding all elements of
+ * the symmetric group Sym(n). The textual representation obtained via toString() is measured for comparison.
+ * Usage: serialization [n]
+ */
+int main(int argc, char **argv) {
+	const perm::AbstractPermutation::value_type n =
+		argc > 1 ? static_cast< perm::AbstractPermutation::value_type >(std::atoi(argv[1])) : 9;
+
+	// Sym(n) is generated by a transposition and an n-cycle
+	std::vector< perm::AbstractPermutation::value_type > cycle;
+	for (perm::AbstractPermutation::value_type i = 0; i < n; ++i) {
+		cycle.push_back(i);
+	}
+
+	const std::vector< perm::Permutation > perms = perm::DiminoAlgorithm::generateGroupElements({
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+		perm::ExplicitPermutation(perm::Cycle(cycle)),
+	});
+
+	std::vector< std::uint8_t > buffer;
+	const double encode = fastestRuntime(5, [&]() {
+		buffer.clear();
+		perm::serialize(perms, buffer);
+	});
+
+	std::vector< perm::Permutation > decoded;
+	const double decode = fastestRuntime(5, [&]() {
+		decoded.clear();
+		std::size_t offset = 0;
+		if (!perm::deserializeTo(buffer.data(), buffer.size(), offset, decoded)) {
+			std::cerr << "Failed to decode permutations\n";
+			std::exit(1);
+		}
+	});
+
+	std::size_t textSize  = 0;
+	const double toString = fastestRuntime(5, [&]() {
+		textSize = 0;
+		for (const perm::Permutation &currentPerm : perms) {
+			textSize += currentPerm->toString().size();
+		}
+	});
+
+	const double megaPerms = static_cast< double >(perms.size()) / 1e6;
+
+	std::cout << "Serializing Sym(" << n << ") (" << perms.size() << " elements)\n";
+	std::cout << "method\tbytes\ttime [ms]\tMperms/s\n";
+	std::cout << "encode\t" << buffer.size() << "\t" << encode << "\t" << megaPerms / (encode / 1000) << "\n";
+	std::cout << "decode\t" << buffer.size() << "\t" << decode << "\t" << megaPerms / (decode / 1000) << "\n";
+	std::cout << "toString\t" << textSize << "\t" << toString << "\t" << megaPerms / (toString / 1000) << "\n";
+
+	return 0;
+}
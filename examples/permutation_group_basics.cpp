@@ -45,6 +45,8 @@ int main() {
 	 * in a different class, but all class implement the perm::AbstractPermutationGroup interface. Currently, the
 	 * following representations are implemented:
 	 * - perm::PrimitivePermutationGroup - represents a group by explicitly storing the group's elements
+	 * - perm::YoungSubgroup - represents a product of (anti)symmetric groups over disjoint blocks of points
+	 * - perm::CyclicGroup and perm::DihedralGroup - represent the symmetries of points arranged on a ring
 	 */
 
 	// By default a group only contains the identity permutation
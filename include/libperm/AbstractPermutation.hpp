@@ -8,6 +8,8 @@
 
 #include "libperm/Cycle.hpp"
 
+#include <cstddef>
+#include <functional>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -45,6 +47,22 @@ public:
 	 * @returns Whether lhs and rhs are considered to be unequal
 	 */
 	friend bool operator!=(const AbstractPermutation &lhs, const AbstractPermutation &rhs);
+	/**
+	 * @returns Whether lhs comes before rhs in the order established by compare()
+	 */
+	friend bool operator<(const AbstractPermutation &lhs, const AbstractPermutation &rhs);
+	/**
+	 * @returns Whether lhs comes after rhs in the order established by compare()
+	 */
+	friend bool operator>(const AbstractPermutation &lhs, const AbstractPermutation &rhs);
+	/**
+	 * @returns Whether lhs doesn't come after rhs in the order established by compare()
+	 */
+	friend bool operator<=(const AbstractPermutation &lhs, const AbstractPermutation &rhs);
+	/**
+	 * @returns Whether lhs doesn't come before rhs in the order established by compare()
+	 */
+	friend bool operator>=(const AbstractPermutation &lhs, const AbstractPermutation &rhs);
 
 	/**
 	 * Multiplies the lhs permutation with rhs and modifies lhs in-place.
@@ -124,6 +142,19 @@ public:
 	 */
 	virtual bool equals(const AbstractPermutation &other) const;
 
+	/**
+	 * @returns A hash of this permutation that is consistent with equals(), i.e. it takes the sign into account but
+	 * not any trailing fixed points
+	 */
+	virtual std::size_t hash() const;
+
+	/**
+	 * @returns A pointer to the images of the points 0, ..., maxElement() stored in contiguous memory or nullptr, if
+	 * this permutation doesn't store its image in this form. This allows algorithms to bypass the per-point image()
+	 * calls where possible.
+	 */
+	virtual const value_type *contiguousImage() const;
+
 	/**
 	 * @returns A string representation of this permutation
 	 */
@@ -158,6 +189,23 @@ public:
 	virtual void insertIntoStream(std::ostream &stream) const = 0;
 };
 
+/**
+ * Three-way comparison of the given permutations. Permutations are ordered lexicographically by their images of the
+ * points 0, 1, 2, ... and permutations with equal images are ordered by their sign (negative before positive). This is
+ * the order by which canonical coset representatives are chosen and it is consistent with equals().
+ *
+ * @returns A negative value, if lhs comes before rhs, zero if they are equal and a positive value otherwise
+ */
+int compare(const AbstractPermutation &lhs, const AbstractPermutation &rhs);
+
 } // namespace perm
 
+namespace std {
+
+template<> struct hash< perm::AbstractPermutation > {
+	std::size_t operator()(const perm::AbstractPermutation &perm) const { return perm.hash(); }
+};
+
+} // namespace std
+
 #endif // LIBPERM_ABSTRACTPERMUTATION_HPP_
@@ -16,6 +16,11 @@ namespace perm {
 
 enum class PermutationGroupType {
 	Primitive,
+	Young,
+	Cyclic,
+	Dihedral,
+	DirectProduct,
+	Mapped,
 };
 
 /**
@@ -36,6 +41,16 @@ public:
 	 */
 	virtual std::vector< AbstractPermutation::value_type > orbit(AbstractPermutation::value_type point) const = 0;
 
+	/**
+	 * Computes the partition of the points acted on by this group's generators into orbits. This only requires a
+	 * single pass over the generators and is therefore cheaper than querying the orbits of all points individually.
+	 *
+	 * @returns The list of orbits, ordered by their smallest point. The points within every orbit are sorted and
+	 * fixed points (below the biggest point moved by any generator) form orbits of their own. For the trivial group,
+	 * the list is empty.
+	 */
+	std::vector< std::vector< AbstractPermutation::value_type > > orbits() const;
+
 	/**
 	 * @returns The order of this group (the amount of elements in it)
 	 */
@@ -75,6 +90,22 @@ public:
 	 */
 	virtual void getElementsTo(std::vector< Permutation > &permutations) const = 0;
 
+	/**
+	 * Maps the given element of this group onto a unique integer in [0, order()). Together with unrank, this allows
+	 * storing and transferring group elements as compact integer ids (e.g. 32-bit) that are decoded lazily. The
+	 * default implementation uses the position of the element in the list obtained from getElementsTo, which is
+	 * expensive. Implementations are expected to override it by something more efficient, if possible.
+	 *
+	 * @returns The rank of the given permutation or order(), if it is not contained in this group
+	 */
+	virtual std::size_t rank(const AbstractPermutation &perm) const;
+
+	/**
+	 * @param rank The rank of the element to obtain, which must be smaller than order()
+	 * @returns The element of this group that has the given rank (see rank)
+	 */
+	virtual Permutation unrank(std::size_t rank) const;
+
 
 	/**
 	 * @returns The left coset gH, where H is the represented group and g is the provided permutation
@@ -6,8 +6,13 @@
 #ifndef LIBPERM_CYCLE_HPP_
 #define LIBPERM_CYCLE_HPP_
 
+#include "libperm/MemoryResource.hpp"
+
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include <numeric>
 #include <ostream>
 #include <set>
@@ -17,62 +22,165 @@
 namespace perm {
 
 /**
- * Class meant to represent permutations in (disjoint) cycle notation
+ * Class meant to represent permutations in (disjoint) cycle notation.
+ *
+ * The points of all cycles are stored back to back in a single buffer and a second buffer holds the offsets at which
+ * the individual cycles start (compressed sparse row layout). Thus, a Cycle requires only two allocations, independent
+ * of the amount of cycles it consists of. Both are obtained from the memory resource of the Cycle's allocator.
  */
 class Cycle {
 public:
 	using value_type     = unsigned int;
-	using iterator       = std::vector< std::vector< value_type > >::iterator;
-	using const_iterator = std::vector< std::vector< value_type > >::const_iterator;
+	using allocator_type = pmr::polymorphic_allocator< value_type >;
+
+	/**
+	 * A lightweight, non-owning view of the points of a single cycle
+	 */
+	class Span {
+	public:
+		using value_type     = Cycle::value_type;
+		using const_iterator = const value_type *;
+		using iterator       = const_iterator;
+
+		Span() = default;
+		Span(const value_type *begin, const value_type *end) : m_begin(begin), m_end(end) {}
+
+		const_iterator begin() const { return m_begin; }
+		const_iterator end() const { return m_end; }
+
+		std::size_t size() const { return static_cast< std::size_t >(m_end - m_begin); }
+		bool empty() const { return m_begin == m_end; }
+
+		value_type operator[](std::size_t index) const {
+			assert(index < size());
+			return m_begin[index];
+		}
+
+		value_type front() const {
+			assert(!empty());
+			return *m_begin;
+		}
+
+		value_type back() const {
+			assert(!empty());
+			return *(m_end - 1);
+		}
+
+		friend bool operator==(const Span &lhs, const Span &rhs) {
+			return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+		}
+		friend bool operator!=(const Span &lhs, const Span &rhs) { return !(lhs == rhs); }
+
+	protected:
+		const value_type *m_begin = nullptr;
+		const value_type *m_end   = nullptr;
+	};
+
+	/**
+	 * Iterator over the individual cycles (represented as Span objects)
+	 */
+	class const_iterator {
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type        = Span;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = const Span *;
+		using reference         = Span;
+
+		const_iterator() = default;
+		const_iterator(const Cycle::value_type *values, const std::size_t *offset)
+			: m_values(values), m_offset(offset) {}
+
+		Span operator*() const { return Span(m_values + m_offset[0], m_values + m_offset[1]); }
+
+		const_iterator &operator++() {
+			++m_offset;
+			return *this;
+		}
+
+		const_iterator operator++(int) {
+			const_iterator copy = *this;
+			++m_offset;
+			return copy;
+		}
+
+		friend bool operator==(const const_iterator &lhs, const const_iterator &rhs) {
+			return lhs.m_offset == rhs.m_offset;
+		}
+		friend bool operator!=(const const_iterator &lhs, const const_iterator &rhs) { return !(lhs == rhs); }
+
+	protected:
+		const Cycle::value_type *m_values = nullptr;
+		const std::size_t *m_offset       = nullptr;
+	};
+
+	/**
+	 * The cycles can't be modified through iterators
+	 */
+	using iterator = const_iterator;
 
 	/**
 	 * Decomposes the permutation given into disjoint cycles.
 	 *
 	 * @return The corresponding disjoint cycle representation
 	 */
-	template< typename image_type > static Cycle fromImage(const std::vector< image_type > &image) {
+	template< typename image_type, typename Alloc >
+	static Cycle fromImage(const std::vector< image_type, Alloc > &image, const allocator_type &alloc = {}) {
+		return fromImage(image.data(), image.size(), alloc);
+	}
+
+	/**
+	 * Decomposes the permutation given by the images of the points 0, ..., size - 1 into disjoint cycles.
+	 *
+	 * @return The corresponding disjoint cycle representation
+	 */
+	template< typename image_type >
+	static Cycle fromImage(const image_type *image, std::size_t size, const allocator_type &alloc = {}) {
 		static_assert(std::is_integral_v< image_type >, "Expected image to use integral type");
-		// Assert that the image point contains all points in [0, n) where n = m_image.size()
-		assert(std::accumulate(image.begin(), image.end(), static_cast< std::size_t >(0))
-			   == image.size() * (image.size() - 1) / 2);
+		// Assert that the image point contains all points in [0, n) where n = size
+		assert(std::accumulate(image, image + size, static_cast< std::size_t >(0)) == size * (size - 1) / 2);
+
+		Cycle cycle(alloc);
 
-		std::set< image_type > visited;
-		std::vector< std::vector< Cycle::value_type > > cycles;
+		// Points that are moved by the permutation are only ever visited once, when following the cycle they are part
+		// of. Thus, we only need to remember which points have been visited already, in order to not process the same
+		// cycle multiple times.
+		std::vector< bool > visited(size, false);
+		cycle.m_values.reserve(size);
 
-		for (image_type i = 0; i < image.size(); ++i) {
-			if (visited.find(i) != visited.end()) {
+		for (std::size_t i = 0; i < size; ++i) {
+			if (visited[i] || static_cast< std::size_t >(image[i]) == i) {
 				continue;
 			}
 
-			visited.insert(i);
-			std::vector< Cycle::value_type > currentCycle;
-			currentCycle.push_back(static_cast< Cycle::value_type >(i));
+			std::size_t j = i;
+			do {
+				visited[j] = true;
+				cycle.m_values.push_back(static_cast< value_type >(j));
 
-			image_type j = image[i];
-			while (j != i) {
-				visited.insert(j);
-				currentCycle.push_back(j);
+				j = static_cast< std::size_t >(image[j]);
+			} while (j != i);
 
-				j = image[j];
-			}
-
-			if (currentCycle.size() > 1) {
-				cycles.push_back(std::move(currentCycle));
-			}
-
-			if (visited.size() == image.size()) {
-				// All elements have been visited -> we can abort the loop
-				break;
-			}
+			cycle.m_offsets.push_back(cycle.m_values.size());
 		}
 
-		return Cycle(std::move(cycles));
+		return cycle;
 	}
 
-	explicit Cycle() = default;
-	explicit Cycle(std::vector< value_type > cycle);
-	explicit Cycle(std::vector< std::vector< value_type > > cycle);
-	~Cycle() = default;
+	explicit Cycle(const allocator_type &alloc = {});
+	explicit Cycle(const std::vector< value_type > &cycle, const allocator_type &alloc = {});
+	explicit Cycle(const std::vector< std::vector< value_type > > &cycles, const allocator_type &alloc = {});
+	/**
+	 * Creates a copy of other that obtains its memory from the given allocator
+	 */
+	Cycle(const Cycle &other, const allocator_type &alloc);
+	Cycle(const Cycle &other) = default;
+	Cycle(Cycle &&other)      = default;
+	~Cycle()                  = default;
+	Cycle &operator=(const Cycle &other) = default;
+	Cycle &operator=(Cycle &&other) = default;
+
+	allocator_type get_allocator() const;
 
 	iterator begin();
 	iterator end();
@@ -81,17 +189,28 @@ public:
 	const_iterator cbegin() const;
 	const_iterator cend() const;
 
+	/**
+	 * @returns The amount of cycles
+	 */
+	std::size_t size() const;
+
+	/**
+	 * @returns The index-th cycle
+	 */
+	Span operator[](std::size_t index) const;
+
 	friend bool operator==(const Cycle &lhs, const Cycle &rhs);
 	friend bool operator!=(const Cycle &lhs, const Cycle &rhs);
 
-	template< typename image_type > std::vector< image_type > toImage(image_type startValue = 0) const {
+	template< typename image_type, typename Alloc = std::allocator< image_type > >
+	std::vector< image_type, Alloc > toImage(image_type startValue = 0, const Alloc &alloc = Alloc()) const {
 		static_assert(std::is_integral_v< image_type >, "Can only create images with integral types");
 
-		std::vector< image_type > image(maxElement() + 1);
+		std::vector< image_type, Alloc > image(maxElement() + 1, alloc);
 
 		std::iota(image.begin(), image.end(), startValue);
 
-		for (const std::vector< value_type > &currentCycle : m_cycles) {
+		for (const Span currentCycle : *this) {
 			if (currentCycle.empty()) {
 				continue;
 			}
@@ -104,17 +223,11 @@ public:
 
 			for (std::size_t i = 0; i < currentCycle.size() - 1; ++i) {
 				// Perform element reassignments according to current cycle
-
-				// Assert that the elements in currentCycle are >= 0. In order to not create a warning that this
-				// comparison is always true when using unsigned types, we use the +1 > 0 trick.
-				assert(currentCycle[i] + 1 > 0);
-				assert(currentCycle[i + 1] + 1 > 0);
-
 				image[currentCycle[i]] = image[currentCycle[i + 1]];
 			}
 
 			// Close the cycle by performing the last -> first switch
-			image[currentCycle[currentCycle.size() - 1]] = temp;
+			image[currentCycle.back()] = temp;
 		}
 
 		return image;
@@ -123,7 +236,15 @@ public:
 	friend std::ostream &operator<<(std::ostream &stream, const Cycle &cycle);
 
 protected:
-	std::vector< std::vector< value_type > > m_cycles;
+	/**
+	 * The points of all cycles (stored back to back)
+	 */
+	pmr::vector< value_type > m_values;
+	/**
+	 * The i-th cycle consists of the points in [m_offsets[i], m_offsets[i + 1]) of m_values. Thus, this always has
+	 * one entry more than there are cycles.
+	 */
+	pmr::vector< std::size_t > m_offsets;
 
 	/**
 	 * @returns The maximum element referenced in this Cycle
@@ -0,0 +1,39 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_CYCLICGROUP_HPP_
+#define LIBPERM_CYCLICGROUP_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/AbstractPermutationGroup.hpp"
+#include "libperm/details/RingGroup.hpp"
+
+namespace perm {
+
+/**
+ * The cyclic group C_n, which describes all rotations of n points arranged on a ring. It is e.g. the symmetry
+ * group of the indices of a (cyclic) trace.
+ *
+ * @see details::RingGroup
+ */
+class CyclicGroup : public details::RingGroup {
+public:
+	CyclicGroup() : CyclicGroup(0) {}
+	/**
+	 * @param n The amount of points on the ring (the points 0..n-1)
+	 */
+	explicit CyclicGroup(AbstractPermutation::value_type n)
+		: details::RingGroup(PermutationGroupType::Cyclic, n, false) {}
+
+	CyclicGroup(const CyclicGroup &) = default;
+	CyclicGroup(CyclicGroup &&)      = default;
+
+	CyclicGroup &operator=(const CyclicGroup &) = default;
+	CyclicGroup &operator=(CyclicGroup &&) = default;
+};
+
+} // namespace perm
+
+#endif // LIBPERM_CYCLICGROUP_HPP_
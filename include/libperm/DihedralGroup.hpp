@@ -0,0 +1,39 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_DIHEDRALGROUP_HPP_
+#define LIBPERM_DIHEDRALGROUP_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/AbstractPermutationGroup.hpp"
+#include "libperm/details/RingGroup.hpp"
+
+namespace perm {
+
+/**
+ * The dihedral group D_n, which describes all rotations and reflections of n points arranged on a ring. It is
+ * e.g. the symmetry group of the indices of a ring-like tensor network that can also be traversed backwards.
+ *
+ * @see details::RingGroup
+ */
+class DihedralGroup : public details::RingGroup {
+public:
+	DihedralGroup() : DihedralGroup(0) {}
+	/**
+	 * @param n The amount of points on the ring (the points 0..n-1)
+	 */
+	explicit DihedralGroup(AbstractPermutation::value_type n)
+		: details::RingGroup(PermutationGroupType::Dihedral, n, true) {}
+
+	DihedralGroup(const DihedralGroup &) = default;
+	DihedralGroup(DihedralGroup &&)      = default;
+
+	DihedralGroup &operator=(const DihedralGroup &) = default;
+	DihedralGroup &operator=(DihedralGroup &&) = default;
+};
+
+} // namespace perm
+
+#endif // LIBPERM_DIHEDRALGROUP_HPP_
@@ -6,8 +6,10 @@
 #ifndef LIBPERM_DOMINOALGORITHM_HPP_
 #define LIBPERM_DOMINOALGORITHM_HPP_
 
+#include "libperm/MemoryResource.hpp"
 #include "libperm/Permutation.hpp"
 
+#include <cstddef>
 #include <vector>
 
 namespace perm {
@@ -28,9 +30,14 @@ namespace DiminoAlgorithm {
 	 * Given a set of generators S, explicitly generate the elements of the group G = < S >.
 	 *
 	 * @param The list of generators of G
+	 * @param threadCount The amount of threads to use for computing the elements of new cosets (0 means as many as
+	 *     there are hardware threads). The order of the produced elements does not depend on this.
+	 * @param resource The memory resource to obtain the memory for the elements' images from. If more than one thread
+	 *     is used, the resource has to be thread-safe.
 	 * @returns A list of elements of G
 	 */
-	std::vector< Permutation > generateGroupElements(const std::vector< Permutation > &S);
+	std::vector< Permutation > generateGroupElements(const std::vector< Permutation > &S, std::size_t threadCount = 1,
+													 pmr::memory_resource *resource = pmr::get_default_resource());
 
 	/**
 	 * Given a subgroup H of a group G (H <= G) and a set of generators S = < S_H, s > such that
@@ -43,9 +50,14 @@ namespace DiminoAlgorithm {
 	 *     extend H by multiple generators. Then you can already collect all generators in S but always
 	 *     point i to the first new generator in the current iteration. Then call this function again
 	 *     with i = i + 1, until all generators are accounted for.
+	 * @param threadCount The amount of threads to use for computing the elements of new cosets (0 means as many as
+	 *     there are hardware threads). The order of the produced elements does not depend on this.
+	 * @param resource The memory resource to obtain the memory for the new elements' images from. If more than one
+	 *     thread is used, the resource has to be thread-safe.
 	 * @returns Whether the new generator has caused an extension of H. That is: it was not redundant
 	 */
-	bool extendGroup(std::vector< Permutation > &H, const std::vector< Permutation > &S, std::size_t i);
+	bool extendGroup(std::vector< Permutation > &H, const std::vector< Permutation > &S, std::size_t i,
+					 std::size_t threadCount = 1, pmr::memory_resource *resource = pmr::get_default_resource());
 
 } // namespace DiminoAlgorithm
 
@@ -0,0 +1,189 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_DIRECTPRODUCTGROUP_HPP_
+#define LIBPERM_DIRECTPRODUCTGROUP_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/AbstractPermutationGroup.hpp"
+#include "libperm/ExplicitPermutation.hpp"
+#include "libperm/Permutation.hpp"
+#include "libperm/PermutationGroup.hpp"
+
+#include <cstddef>
+#include <iosfwd>
+#include <numeric>
+#include <vector>
+
+namespace perm {
+
+/**
+ * Represents the direct product of groups that act on disjoint, contiguous blocks of points. Instead of explicitly
+ * generating the elements of the product (whose amount is the product of the factors' orders), only the factors are
+ * stored. All queries are then answered by delegating to the factor(s) acting on the respective block(s).
+ *
+ * When new generators connect points of different blocks, the affected factors are merged into a single one. The same
+ * happens to factors that all contain the negative identity, as their elements wouldn't combine uniquely otherwise.
+ */
+class DirectProductGroup : public AbstractPermutationGroup {
+public:
+	struct Factor {
+		/**
+		 * The group acting on this block. Its points are given relative to the block's offset.
+		 */
+		PermutationGroup group;
+		/**
+		 * The first point of the block
+		 */
+		AbstractPermutation::value_type offset;
+		/**
+		 * The amount of points in the block
+		 */
+		AbstractPermutation::value_type size;
+	};
+
+	DirectProductGroup();
+	/**
+	 * Constructs the group generated by the given generators. The generators are automatically partitioned into
+	 * independent factors.
+	 */
+	DirectProductGroup(std::vector< Permutation > generators);
+	/**
+	 * Constructs the direct product of the given factors. The blocks of the factors must not overlap.
+	 */
+	DirectProductGroup(std::vector< Factor > factors);
+
+	DirectProductGroup(const DirectProductGroup &) = default;
+	DirectProductGroup(DirectProductGroup &&)      = default;
+
+	DirectProductGroup &operator=(const DirectProductGroup &) = default;
+	DirectProductGroup &operator=(DirectProductGroup &&) = default;
+
+	/**
+	 * Appends the given group as an additional factor that acts on the points starting at the given offset. If the
+	 * given group is a DirectProductGroup itself, its factors are appended individually.
+	 *
+	 * @param group The group to append
+	 * @param offset The point that the group's 0 shall correspond to. Must be bigger than all points that the already
+	 * present factors act on.
+	 * @param excludes A sorted list of (group-local) points that shall be removed before appending the group. All
+	 * symmetries involving these points are dropped and the remaining points are moved down accordingly.
+	 */
+	void append(const AbstractPermutationGroup &group, AbstractPermutation::value_type offset,
+				const std::vector< std::size_t > &excludes = {});
+
+	/**
+	 * @returns The factors of this direct product, ordered by their offset
+	 */
+	const std::vector< Factor > &getFactors() const;
+
+	/**
+	 * Lazily enumerates the elements of this group. Only the elements of the individual factors are explicitly
+	 * generated, all elements of the product are created on-the-fly.
+	 *
+	 * @param callback A callable that is invoked with every element (as a const ExplicitPermutation &) of this group
+	 */
+	template< typename Callback > void forEachElement(Callback &&callback) const {
+		std::vector< std::vector< Permutation > > factorElements(m_factors.size());
+		for (std::size_t i = 0; i < m_factors.size(); ++i) {
+			m_factors[i].group->getElementsTo(factorElements[i]);
+		}
+
+		std::vector< std::size_t > indices(m_factors.size(), 0);
+		std::vector< AbstractPermutation::value_type > image(pointCount());
+
+		while (true) {
+			std::iota(image.begin(), image.end(), 0);
+			int sign = 1;
+
+			for (std::size_t i = 0; i < m_factors.size(); ++i) {
+				const Factor &currentFactor                     = m_factors[i];
+				const AbstractPermutation &currentFactorElement = factorElements[i][indices[i]];
+
+				for (AbstractPermutation::value_type k = 0; k < currentFactor.size; ++k) {
+					image[currentFactor.offset + k] = currentFactor.offset + currentFactorElement.image(k);
+				}
+
+				sign *= currentFactorElement.sign();
+			}
+
+			const ExplicitPermutation element(image, sign);
+			callback(element);
+
+			// Advance the indices in an odometer-like fashion
+			std::size_t i = 0;
+			while (i < indices.size() && ++indices[i] == factorElements[i].size()) {
+				indices[i] = 0;
+				++i;
+			}
+
+			if (i == indices.size()) {
+				break;
+			}
+		}
+	}
+
+
+	virtual std::vector< AbstractPermutation::value_type >
+		orbit(AbstractPermutation::value_type point) const override final;
+
+	/**
+	 * @throws std::overflow_error if the product of the factors' orders can't be represented as a std::size_t. The same
+	 * applies to rank.
+	 */
+	virtual std::size_t order() const override final;
+
+	virtual bool contains(const AbstractPermutation &perm) const override final;
+
+	virtual bool addGenerator(Permutation perm) override final;
+
+	virtual void setGenerators(std::vector< Permutation > generators) override final;
+
+	virtual const std::vector< Permutation > &getGenerators() const override final;
+
+	virtual void getElementsTo(std::vector< Permutation > &permutations) const override final;
+
+	virtual std::size_t rank(const AbstractPermutation &perm) const override final;
+
+	virtual Permutation unrank(std::size_t rank) const override final;
+
+	virtual std::vector< Permutation > leftCoset(const AbstractPermutation &perm) const override final;
+
+	virtual std::vector< Permutation > rightCoset(const AbstractPermutation &perm) const override final;
+
+	virtual Permutation leftCosetRepresentative(const AbstractPermutation &perm) const override;
+
+	virtual Permutation rightCosetRepresentative(const AbstractPermutation &perm) const override;
+
+	friend std::ostream &operator<<(std::ostream &stream, const DirectProductGroup &group);
+
+protected:
+	std::vector< Factor > m_factors;
+	std::vector< Permutation > m_generators;
+
+	/**
+	 * @returns The amount of points covered by the blocks of this group (including points in-between blocks)
+	 */
+	AbstractPermutation::value_type pointCount() const;
+
+	/**
+	 * @returns The index of the factor acting on the given point or the amount of factors, if there is none
+	 */
+	std::size_t factorIndex(AbstractPermutation::value_type point) const;
+
+	void addFactor(Factor factor);
+
+	/**
+	 * Merges all factors that contain the negative identity into a single factor, so that every element of this group
+	 * is a unique combination of the factors' elements
+	 */
+	void mergeSignedFactors();
+
+	void updateGenerators();
+};
+
+} // namespace perm
+
+#endif // LIBPERM_DIRECTPRODUCTGROUP_HPP_
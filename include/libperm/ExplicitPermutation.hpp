@@ -7,14 +7,33 @@
 #define LIBPERM_EXPLICITPERMUTATION_HPP_
 
 #include "libperm/Cycle.hpp"
+#include "libperm/MemoryResource.hpp"
 #include "libperm/details/SignedPermutation.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <vector>
 
+#ifdef LIBPERM_CACHE_HASHES
+#	include <atomic>
+#endif
+
 namespace perm {
 
+class PermutationProduct;
+class PermutationWord;
+
+/**
+ * A permutation that explicitly stores the images of all points up to the biggest point it moves. The memory for the
+ * images is obtained from the memory resource of the permutation's allocator. As for the standard containers, copies
+ * use the default resource unless the allocator-extended constructor is used.
+ */
 class ExplicitPermutation : public details::SignedPermutation {
 public:
+	using image_type     = pmr::vector< value_type >;
+	using allocator_type = image_type::allocator_type;
+
 	/**
 	 * Construct an ExplicitPermutation object off the given (disjoint) cycle notation.
 	 *
@@ -25,12 +44,34 @@ public:
 		fromCycle(const Cycle &cycle, int sign = 1);
 
 	explicit ExplicitPermutation(int sign = 1);
-	explicit ExplicitPermutation(std::vector< value_type > image, int sign = 1);
-	ExplicitPermutation(const Cycle &cycle, int sign = 1);
-	ExplicitPermutation(const ExplicitPermutation &other) = default;
-	ExplicitPermutation(ExplicitPermutation &&other)      = default;
+	/**
+	 * Constructs the (positive) identity that obtains its memory from the given allocator
+	 */
+	explicit ExplicitPermutation(const allocator_type &alloc);
+	/**
+	 * The constructed perm takes over the given image (including its allocator)
+	 */
+	explicit ExplicitPermutation(image_type image, int sign = 1);
+	template< typename Alloc >
+	explicit ExplicitPermutation(const std::vector< value_type, Alloc > &image, int sign = 1,
+								 const allocator_type &alloc = {})
+		: ExplicitPermutation(image_type(image.begin(), image.end(), alloc), sign) {}
+	ExplicitPermutation(const Cycle &cycle, int sign = 1, const allocator_type &alloc = {});
+	/**
+	 * Creates an explicit representation of the given permutation that obtains its memory from the given allocator
+	 */
+	ExplicitPermutation(const AbstractPermutation &other, const allocator_type &alloc);
+	ExplicitPermutation(const ExplicitPermutation &other);
+	ExplicitPermutation(ExplicitPermutation &&other) noexcept;
 	~ExplicitPermutation();
-	ExplicitPermutation &operator=(const ExplicitPermutation &other) = default;
+	ExplicitPermutation &operator=(const ExplicitPermutation &other);
+	/**
+	 * Note: If both objects use the same memory resource, the moved-from object is left holding the previous value of
+	 * this object. Otherwise, the images are copied.
+	 */
+	ExplicitPermutation &operator=(ExplicitPermutation &&other);
+
+	allocator_type get_allocator() const;
 
 	value_type maxElement() const override;
 
@@ -40,10 +81,19 @@ public:
 	 * @returns The image of the set 0..n under this permutation where n is the largest number that this permutation
 	 * actually permutes.
 	 */
-	const std::vector< value_type > &image() const;
+	const image_type &image() const;
+
+	const value_type *contiguousImage() const override;
 
 	void invert() override;
 
+	/**
+	 * If libPerm is built with the LIBPERM_CACHE_HASHES option, the hash of the image is cached, so that repeated
+	 * hashing (e.g. when rehashing an unordered container) doesn't have to process the image again. The cache is
+	 * invalidated whenever the image changes. Otherwise (the default), the hash is computed on every call.
+	 */
+	std::size_t hash() const override;
+
 	void preMultiply(const AbstractPermutation &other) override;
 
 	void postMultiply(const AbstractPermutation &other) override;
@@ -57,12 +107,40 @@ public:
 	friend ExplicitPermutation operator*(const ExplicitPermutation &lhs, const AbstractPermutation &rhs);
 	friend ExplicitPermutation operator*(const AbstractPermutation &lhs, const ExplicitPermutation &rhs);
 	friend ExplicitPermutation operator*(const ExplicitPermutation &lhs, const ExplicitPermutation &rhs);
+	friend ExplicitPermutation operator*(ExplicitPermutation &&lhs, const AbstractPermutation &rhs);
+	friend ExplicitPermutation operator*(ExplicitPermutation &&lhs, const ExplicitPermutation &rhs);
+
+	/**
+	 * Stores the product of lhs and rhs (FIRST applying lhs and THEN rhs) in destination. The memory already held by
+	 * destination is reused, so that no memory has to be allocated as long as its capacity suffices. destination
+	 * may be the same object as lhs and/or rhs.
+	 */
+	friend void composeInto(ExplicitPermutation &destination, const AbstractPermutation &lhs,
+							const AbstractPermutation &rhs);
+
+	/**
+	 * Stores the inverse of source in destination. The memory already held by destination is reused, so that no memory
+	 * has to be allocated as long as its capacity suffices. destination may be the same object as source.
+	 */
+	friend void invertInto(ExplicitPermutation &destination, const AbstractPermutation &source);
+
+	// Lazy products materialize their result directly into our image
+	friend class PermutationProduct;
+	friend class PermutationWord;
 
 protected:
-	std::vector< value_type > m_image;
+	image_type m_image;
+#ifdef LIBPERM_CACHE_HASHES
+	/**
+	 * The cached hash of m_image or zero, if it has not been computed yet. This is atomic as hashing may happen
+	 * concurrently on a shared (const) object. Caching is opt-in (via the LIBPERM_CACHE_HASHES option), as it adds
+	 * 8 bytes to every permutation, which only pays off if the same permutations are hashed repeatedly.
+	 */
+	mutable std::atomic< std::size_t > m_imageHash{ 0 };
+#endif
 
 	/**
-	 * Multiplies this perm by itself
+	 * Multiplies this perm by itself (in-place)
 	 */
 	void selfMultiply();
 
@@ -78,6 +156,29 @@ protected:
 	void reduceImageRepresentation();
 };
 
+void composeInto(ExplicitPermutation &destination, const AbstractPermutation &lhs, const AbstractPermutation &rhs);
+void invertInto(ExplicitPermutation &destination, const AbstractPermutation &source);
+
+/**
+ * Computes the k-th power of the given permutation in O(n) by rotating each of its cycles by k positions (instead of
+ * performing k multiplications). Negative exponents yield powers of the inverse. The result obtains its memory from the
+ * given allocator.
+ */
+ExplicitPermutation power(const AbstractPermutation &perm, std::int64_t k,
+						  const ExplicitPermutation::allocator_type &alloc = {});
+
+/**
+ * @returns The order of the given permutation, i.e. the smallest k > 0 for which perm^k is the (positive) identity.
+ * This is the least common multiple of the lengths of its cycles, doubled if that leaves the sign negative.
+ */
+std::size_t order(const AbstractPermutation &perm);
+
 } // namespace perm
 
+namespace std {
+
+template<> struct hash< perm::ExplicitPermutation > : hash< perm::AbstractPermutation > {};
+
+} // namespace std
+
 #endif // LIBPERM_EXPLICITPERMUTATION_HPP_
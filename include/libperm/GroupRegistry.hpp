@@ -0,0 +1,107 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_GROUPREGISTRY_HPP_
+#define LIBPERM_GROUPREGISTRY_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/Permutation.hpp"
+#include "libperm/PrimitivePermutationGroup.hpp"
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace perm {
+
+/**
+ * A thread-safe cache of fully generated permutation groups. Groups are identified by their set of generators, where
+ * neither the order of the generators nor duplicate or identity generators matter. Thus, requesting the same group
+ * multiple times (even with differently ordered generators) only generates its elements once.
+ */
+class GroupRegistry {
+public:
+	struct Statistics {
+		/**
+		 * The amount of requests that could be served by an already registered group
+		 */
+		std::size_t hits = 0;
+		/**
+		 * The amount of requests for which a new group had to be generated
+		 */
+		std::size_t misses = 0;
+		/**
+		 * The amount of groups currently held by the registry
+		 */
+		std::size_t groups = 0;
+		/**
+		 * An estimate of the amount of memory (in bytes) that is used by the elements of the registered groups
+		 */
+		std::size_t memory = 0;
+	};
+
+	GroupRegistry() = default;
+
+	GroupRegistry(const GroupRegistry &) = delete;
+	GroupRegistry &operator=(const GroupRegistry &) = delete;
+
+	/**
+	 * @returns The process-wide registry instance
+	 */
+	static GroupRegistry &global();
+
+	/**
+	 * @returns The group generated by the given generators. The group's elements have already been generated, when
+	 * this function returns. If the group has been requested before, the same object is returned again.
+	 *
+	 * If generating the group throws, the exception is propagated to this call as well as to all concurrent calls
+	 * waiting for the same group and the group is not registered.
+	 */
+	std::shared_ptr< const PrimitivePermutationGroup > get(const std::vector< Permutation > &generators);
+
+	/**
+	 * @returns Statistics about the usage of this registry
+	 */
+	Statistics statistics() const;
+
+	/**
+	 * Removes all groups from this registry and resets the statistics. Groups that are still in use elsewhere, remain
+	 * valid.
+	 */
+	void clear();
+
+protected:
+	/**
+	 * The canonical form of a generator: its sign and its image (without trailing fixed points)
+	 */
+	using GeneratorKey = std::pair< int, std::vector< AbstractPermutation::value_type > >;
+	using Key          = std::vector< GeneratorKey >;
+
+	struct KeyHash {
+		std::size_t operator()(const Key &key) const;
+	};
+
+	struct Entry {
+		std::shared_future< std::shared_ptr< const PrimitivePermutationGroup > > group;
+		std::size_t memory = 0;
+	};
+
+	mutable std::mutex m_mutex;
+	std::unordered_map< Key, Entry, KeyHash > m_groups;
+	Statistics m_statistics;
+
+	/**
+	 * @returns The canonical representation of the given set of generators
+	 */
+	static Key canonicalize(const std::vector< Permutation > &generators);
+};
+
+} // namespace perm
+
+#endif // LIBPERM_GROUPREGISTRY_HPP_
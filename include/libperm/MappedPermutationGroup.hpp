@@ -0,0 +1,165 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_MAPPEDPERMUTATIONGROUP_HPP_
+#define LIBPERM_MAPPEDPERMUTATIONGROUP_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/AbstractPermutationGroup.hpp"
+#include "libperm/ExplicitPermutation.hpp"
+#include "libperm/Permutation.hpp"
+#include "libperm/details/MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace perm {
+
+/**
+ * A read-only permutation group whose elements are stored in a binary file (or memory buffer) that has been created
+ * via MappedPermutationGroup::write. The file is memory-mapped and all queries are answered directly from the mapped
+ * element table without copying it. Loading only requires a single validation pass over the tables (making sure that
+ * every row is a permutation of the points 0, ..., n - 1 and that the element table is sorted), so that corrupted
+ * files are rejected instead of causing out-of-bounds accesses later on. As the element table is sorted, membership
+ * tests and ranking are binary searches (O(n log |G|)), whereas orbits are computed from the generators alone.
+ *
+ * File format (version 1, all integers in the byte order of the writing machine):
+ * - Header (88 bytes): magic "LIBPERMG", version (u32), byte order mark 0x01020304 (u32), flags (u32, bit 0 is
+ *   reserved for BSGS data, which this version never writes), degree n (u32), bytes per point (u32, 1, 2 or 4),
+ *   reserved (u32), generator count (u64), order (u64), offsets of the generator table, the generator signs, the
+ *   element table and the element signs (4x u64), total size (u64)
+ * - Generator and element tables: One row of n packed image points per permutation. The rows of the element table
+ *   are strictly ascending in the order established by compare().
+ * - Generator and element signs: One bit per permutation (set for negative signs)
+ *
+ * All sections start at offsets that are multiples of 8.
+ *
+ * Note: Generators can't be changed. Only elements that are already contained in the group are accepted by
+ * addGenerator and setGenerators, which throw std::invalid_argument for any other permutation.
+ */
+class MappedPermutationGroup : public AbstractPermutationGroup {
+public:
+	/**
+	 * The version of the binary format that is written and understood by this class
+	 */
+	static constexpr std::uint32_t formatVersion = 1;
+
+	MappedPermutationGroup(const MappedPermutationGroup &) = delete;
+	MappedPermutationGroup(MappedPermutationGroup &&)      = default;
+
+	MappedPermutationGroup &operator=(const MappedPermutationGroup &) = delete;
+	MappedPermutationGroup &operator=(MappedPermutationGroup &&) = default;
+
+	/**
+	 * Writes the binary representation of the given group to the given stream. Note that this requires the
+	 * group's elements to be generated explicitly.
+	 *
+	 * @returns Whether writing has succeeded
+	 */
+	static bool write(const AbstractPermutationGroup &group, std::ostream &stream);
+
+	/**
+	 * Memory-maps the group stored in the given file
+	 *
+	 * @returns The loaded group or an empty optional, if the file doesn't exist or doesn't contain a valid group
+	 */
+	static std::optional< MappedPermutationGroup > open(const std::string &path);
+
+	/**
+	 * Uses the group stored in the given memory buffer. The buffer is not copied and thus has to outlive the returned
+	 * group. It has to be aligned to 8 bytes.
+	 *
+	 * @returns The loaded group or an empty optional, if the buffer doesn't contain a valid group
+	 */
+	static std::optional< MappedPermutationGroup > fromBuffer(const void *data, std::size_t size);
+
+	/**
+	 * @returns The amount of points that the stored element table covers (all bigger points are fixed)
+	 */
+	AbstractPermutation::value_type degree() const;
+
+
+	virtual std::vector< AbstractPermutation::value_type >
+		orbit(AbstractPermutation::value_type point) const override final;
+
+	virtual std::size_t order() const override final;
+
+	virtual bool contains(const AbstractPermutation &perm) const override final;
+
+	/**
+	 * @throws std::invalid_argument if the given permutation is not contained in this group
+	 */
+	virtual bool addGenerator(Permutation perm) override final;
+
+	/**
+	 * @throws std::invalid_argument if any of the given permutations is not contained in this group
+	 */
+	virtual void setGenerators(std::vector< Permutation > generators) override final;
+
+	virtual const std::vector< Permutation > &getGenerators() const override final;
+
+	virtual void getElementsTo(std::vector< Permutation > &permutations) const override final;
+
+	virtual std::size_t rank(const AbstractPermutation &perm) const override final;
+
+	virtual Permutation unrank(std::size_t rank) const override final;
+
+	virtual std::vector< Permutation > leftCoset(const AbstractPermutation &perm) const override final;
+
+	virtual std::vector< Permutation > rightCoset(const AbstractPermutation &perm) const override final;
+
+	virtual Permutation leftCosetRepresentative(const AbstractPermutation &perm) const override;
+
+	virtual Permutation rightCosetRepresentative(const AbstractPermutation &perm) const override;
+
+	friend std::ostream &operator<<(std::ostream &stream, const MappedPermutationGroup &group);
+
+protected:
+	details::MappedFile m_file;
+	AbstractPermutation::value_type m_degree = 0;
+	std::uint32_t m_pointWidth               = 1;
+	std::size_t m_order                      = 0;
+	const unsigned char *m_elements          = nullptr;
+	const unsigned char *m_elementSigns      = nullptr;
+	std::vector< Permutation > m_generators;
+
+	MappedPermutationGroup();
+
+	/**
+	 * Initializes this group from the given binary representation
+	 *
+	 * @returns Whether the given data represents a valid group
+	 */
+	bool load(const unsigned char *data, std::size_t size);
+
+	/**
+	 * @returns The image of the given point (which must be smaller than the degree) under the element in the given
+	 * row of the element table
+	 */
+	AbstractPermutation::value_type image(std::size_t row, AbstractPermutation::value_type point) const;
+
+	/**
+	 * @returns The sign of the element in the given row of the element table
+	 */
+	int sign(std::size_t row) const;
+
+	/**
+	 * @returns The element in the given row of the element table
+	 */
+	ExplicitPermutation element(std::size_t row) const;
+
+	/**
+	 * @returns The canonical representative of the coset of the given permutation
+	 */
+	template< bool left > Permutation cosetRepresentative(const AbstractPermutation &perm) const;
+};
+
+} // namespace perm
+
+#endif // LIBPERM_MAPPEDPERMUTATIONGROUP_HPP_
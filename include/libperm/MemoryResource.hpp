@@ -0,0 +1,147 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_MEMORYRESOURCE_HPP_
+#define LIBPERM_MEMORYRESOURCE_HPP_
+
+#if __has_include(<version>)
+#	include <version>
+#endif
+
+#if defined(__cpp_lib_memory_resource) && !defined(LIBPERM_NO_STD_PMR)
+#	include <memory_resource>
+#	define LIBPERM_STD_PMR
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * Everything in libPerm that allocates memory for images, cycles or group elements can be told to obtain it from a
+ * memory resource. This namespace provides the corresponding types, which are the ones from std::pmr, if the standard
+ * library supports them. Otherwise, a minimal replacement with the same interface is provided, so that the same code
+ * compiles in either case.
+ */
+namespace perm::pmr {
+
+#ifdef LIBPERM_STD_PMR
+
+using std::pmr::get_default_resource;
+using std::pmr::memory_resource;
+using std::pmr::new_delete_resource;
+using std::pmr::polymorphic_allocator;
+using std::pmr::set_default_resource;
+
+template< typename T > using vector = std::pmr::vector< T >;
+
+#else
+
+class memory_resource {
+public:
+	virtual ~memory_resource() = default;
+
+	void *allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+		return do_allocate(bytes, alignment);
+	}
+
+	void deallocate(void *p, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+		do_deallocate(p, bytes, alignment);
+	}
+
+	bool is_equal(const memory_resource &other) const noexcept { return do_is_equal(other); }
+
+	friend bool operator==(const memory_resource &lhs, const memory_resource &rhs) noexcept {
+		return &lhs == &rhs || lhs.is_equal(rhs);
+	}
+	friend bool operator!=(const memory_resource &lhs, const memory_resource &rhs) noexcept { return !(lhs == rhs); }
+
+protected:
+	virtual void *do_allocate(std::size_t bytes, std::size_t alignment)           = 0;
+	virtual void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) = 0;
+	virtual bool do_is_equal(const memory_resource &other) const noexcept         = 0;
+};
+
+namespace details {
+
+	class NewDeleteResource : public memory_resource {
+	protected:
+		void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+			return ::operator new(bytes, std::align_val_t(alignment));
+		}
+
+		void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+			::operator delete(p, bytes, std::align_val_t(alignment));
+		}
+
+		bool do_is_equal(const memory_resource &other) const noexcept override { return this == &other; }
+	};
+
+} // namespace details
+
+inline memory_resource *new_delete_resource() noexcept {
+	static details::NewDeleteResource resource;
+
+	return &resource;
+}
+
+namespace details {
+
+	inline std::atomic< memory_resource * > &defaultResource() noexcept {
+		static std::atomic< memory_resource * > resource{ new_delete_resource() };
+
+		return resource;
+	}
+
+} // namespace details
+
+inline memory_resource *get_default_resource() noexcept {
+	return details::defaultResource().load();
+}
+
+inline memory_resource *set_default_resource(memory_resource *resource) noexcept {
+	return details::defaultResource().exchange(resource ? resource : new_delete_resource());
+}
+
+template< typename T > class polymorphic_allocator {
+public:
+	using value_type = T;
+
+	polymorphic_allocator() noexcept : m_resource(get_default_resource()) {}
+	polymorphic_allocator(memory_resource *resource) : m_resource(resource) {}
+	polymorphic_allocator(const polymorphic_allocator &other) = default;
+	template< typename U >
+	polymorphic_allocator(const polymorphic_allocator< U > &other) noexcept : m_resource(other.resource()) {}
+
+	polymorphic_allocator &operator=(const polymorphic_allocator &) = delete;
+
+	T *allocate(std::size_t n) { return static_cast< T * >(m_resource->allocate(n * sizeof(T), alignof(T))); }
+
+	void deallocate(T *p, std::size_t n) { m_resource->deallocate(p, n * sizeof(T), alignof(T)); }
+
+	/**
+	 * Copies of containers don't inherit the memory resource of the original container
+	 */
+	polymorphic_allocator select_on_container_copy_construction() const { return polymorphic_allocator(); }
+
+	memory_resource *resource() const { return m_resource; }
+
+	friend bool operator==(const polymorphic_allocator &lhs, const polymorphic_allocator &rhs) {
+		return *lhs.resource() == *rhs.resource();
+	}
+	friend bool operator!=(const polymorphic_allocator &lhs, const polymorphic_allocator &rhs) { return !(lhs == rhs); }
+
+protected:
+	memory_resource *m_resource;
+};
+
+template< typename T > using vector = std::vector< T, polymorphic_allocator< T > >;
+
+#endif
+
+} // namespace perm::pmr
+
+#endif // LIBPERM_MEMORYRESOURCE_HPP_
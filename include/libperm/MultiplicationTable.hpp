@@ -0,0 +1,65 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_MULTIPLICATIONTABLE_HPP_
+#define LIBPERM_MULTIPLICATIONTABLE_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace perm {
+
+/**
+ * A table of element indices of some group, where the entry (row, column) is the index of the product of the row-th
+ * element with the column-th factor. Depending on the table, the factors are e.g. the group's generators or all of its
+ * elements (Cayley table). The entries are stored contiguously in row-major order.
+ */
+class MultiplicationTable {
+public:
+	using index_type = std::uint32_t;
+
+	MultiplicationTable() = default;
+	MultiplicationTable(std::size_t rows, std::size_t columns) : m_columns(columns), m_entries(rows * columns) {}
+
+	std::size_t rows() const { return m_columns == 0 ? 0 : m_entries.size() / m_columns; }
+
+	std::size_t columns() const { return m_columns; }
+
+	/**
+	 * @returns The index of the element that is the product of the row-th element and the column-th factor
+	 */
+	index_type operator()(std::size_t row, std::size_t column) const {
+		assert(column < m_columns);
+		assert(row * m_columns + column < m_entries.size());
+
+		return m_entries[row * m_columns + column];
+	}
+
+	index_type &operator()(std::size_t row, std::size_t column) {
+		assert(column < m_columns);
+		assert(row * m_columns + column < m_entries.size());
+
+		return m_entries[row * m_columns + column];
+	}
+
+	/**
+	 * @returns A pointer to the entries of the given row
+	 */
+	const index_type *row(std::size_t row) const {
+		assert(row < rows());
+
+		return m_entries.data() + row * m_columns;
+	}
+
+protected:
+	std::size_t m_columns = 0;
+	std::vector< index_type > m_entries;
+};
+
+} // namespace perm
+
+#endif // LIBPERM_MULTIPLICATIONTABLE_HPP_
@@ -0,0 +1,107 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_PACKEDPERMUTATION_HPP_
+#define LIBPERM_PACKEDPERMUTATION_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/Cycle.hpp"
+#include "libperm/details/SignedPermutation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace perm {
+
+/**
+ * A permutation of (at most) the points 0, ..., 15 that stores the images of all of these points in a single 64-bit
+ * word, using 4 bits per point. The image of point i is stored in bits [4i, 4i + 4). Thus, a group with tens of
+ * thousands of such elements still fits into the L2 cache and composition, inversion and comparison of two packed
+ * permutations are branch-free operations on a single word that don't allocate any memory.
+ *
+ * Multiplying with other permutation types is supported, as long as they act on the points 0, ..., 15 only. All
+ * operations that would move a point beyond 15 throw a std::out_of_range exception and leave the permutation unchanged.
+ */
+class PackedPermutation : public details::SignedPermutation {
+public:
+	using packed_type = std::uint64_t;
+
+	/**
+	 * The amount of points a packed permutation can act on
+	 */
+	static constexpr const std::size_t max_points = 16;
+
+	/**
+	 * The packed image of the identity
+	 */
+	static constexpr const packed_type identity_image = 0xFEDCBA9876543210;
+
+	/**
+	 * @param packedImage The packed images of the points 0, ..., 15. Every point has to appear exactly once.
+	 * @returns The corresponding permutation
+	 */
+	static PackedPermutation fromPackedImage(packed_type packedImage, int sign = 1);
+
+	explicit PackedPermutation(int sign = 1);
+	/**
+	 * @param image The images of the points 0, ..., n - 1. Only the points 0, ..., 15 may be moved.
+	 * @throws std::out_of_range if a point beyond 15 is moved
+	 */
+	explicit PackedPermutation(const std::vector< value_type > &image, int sign = 1);
+	PackedPermutation(const Cycle &cycle, int sign = 1);
+	/**
+	 * Creates a packed representation of the given permutation
+	 *
+	 * @throws std::out_of_range if the given permutation moves a point beyond 15
+	 */
+	explicit PackedPermutation(const AbstractPermutation &perm);
+	PackedPermutation(const PackedPermutation &other) = default;
+	PackedPermutation(PackedPermutation &&other)      = default;
+	~PackedPermutation()                              = default;
+	PackedPermutation &operator=(const PackedPermutation &other) = default;
+	PackedPermutation &operator=(PackedPermutation &&other) = default;
+
+	value_type maxElement() const override;
+
+	value_type image(value_type value) const override;
+
+	/**
+	 * @returns The packed images of the points 0, ..., 15
+	 */
+	packed_type packedImage() const;
+
+	bool isIdentity() const override;
+
+	void invert() override;
+
+	void preMultiply(const AbstractPermutation &other) override;
+
+	void postMultiply(const AbstractPermutation &other) override;
+
+	bool equals(const AbstractPermutation &other) const override;
+
+	std::size_t hash() const override;
+
+	Cycle toCycle() const override;
+
+	void shift(int shift, std::size_t startIndex = 0) override;
+
+	void insertIntoStream(std::ostream &stream) const override;
+
+protected:
+	packed_type m_image = identity_image;
+};
+
+} // namespace perm
+
+namespace std {
+
+template<> struct hash< perm::PackedPermutation > : hash< perm::AbstractPermutation > {};
+
+} // namespace std
+
+#endif // LIBPERM_PACKEDPERMUTATION_HPP_
@@ -8,9 +8,14 @@
 
 #include "libperm/AbstractPermutation.hpp"
 #include "libperm/ExplicitPermutation.hpp"
+#include "libperm/PackedPermutation.hpp"
+#include "libperm/SparsePermutation.hpp"
 
 #include <pv/polymorphic_variant.hpp>
 
+#include <cstddef>
+#include <functional>
+
 namespace perm {
 
 /**
@@ -20,8 +25,17 @@ namespace perm {
  * would be used (plus a bit more)), but without the need to deal with pointers and/or dynamic memory allocations just
  * to be able to use polymorphism.
  */
-using Permutation = pv::polymorphic_variant< AbstractPermutation, ExplicitPermutation >;
+using Permutation =
+	pv::polymorphic_variant< AbstractPermutation, ExplicitPermutation, SparsePermutation, PackedPermutation >;
 
 } // namespace perm
 
+namespace std {
+
+template<> struct hash< perm::Permutation > {
+	std::size_t operator()(const perm::Permutation &perm) const { return perm->hash(); }
+};
+
+} // namespace std
+
 #endif // LIBPERM_PERMUTATION_HPP_
@@ -0,0 +1,36 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_PERMUTATIONGROUP_HPP_
+#define LIBPERM_PERMUTATIONGROUP_HPP_
+
+#include "libperm/AbstractPermutationGroup.hpp"
+#include "libperm/CyclicGroup.hpp"
+#include "libperm/DihedralGroup.hpp"
+#include "libperm/PrimitivePermutationGroup.hpp"
+#include "libperm/YoungSubgroup.hpp"
+
+#include <pv/polymorphic_variant.hpp>
+
+namespace perm {
+
+/**
+ * Type-definition for a general permutation group object. In analogy to Permutation, the actual group's implementation
+ * could be any of the ones provided in the list given as template arguments (except for the first entry, which only
+ * defines the base-class's type).
+ */
+using PermutationGroup =
+	pv::polymorphic_variant< AbstractPermutationGroup, PrimitivePermutationGroup, YoungSubgroup, CyclicGroup,
+							 DihedralGroup >;
+
+/**
+ * Creates a copy of the given group as a PermutationGroup. Groups whose type can't be represented by a
+ * PermutationGroup are converted into a PrimitivePermutationGroup.
+ */
+PermutationGroup toPermutationGroup(const AbstractPermutationGroup &group);
+
+} // namespace perm
+
+#endif // LIBPERM_PERMUTATIONGROUP_HPP_
@@ -0,0 +1,184 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_PERMUTATIONPRODUCT_HPP_
+#define LIBPERM_PERMUTATIONPRODUCT_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/ExplicitPermutation.hpp"
+#include "libperm/Permutation.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace perm {
+
+namespace details {
+
+	/**
+	 * A factor of a lazily evaluated product. If the factor stores its images contiguously, images are looked up
+	 * directly instead of going through a virtual function call.
+	 */
+	struct ProductFactor {
+		const AbstractPermutation *perm;
+		const AbstractPermutation::value_type *image;
+		AbstractPermutation::value_type imageSize;
+
+		explicit ProductFactor(const AbstractPermutation &factor)
+			: perm(&factor), image(factor.contiguousImage()), imageSize(factor.maxElement() + 1) {}
+
+		AbstractPermutation::value_type apply(AbstractPermutation::value_type value) const {
+			if (image) {
+				return value < imageSize ? image[value] : value;
+			}
+
+			return perm->image(value);
+		}
+	};
+
+} // namespace details
+
+/**
+ * A product of permutations that is only evaluated on demand. Instead of creating a temporary permutation for every
+ * individual multiplication, the factors are only recorded and image() applies them one after the other to the
+ * requested point. materialize() computes all images of the product in a single pass.
+ *
+ * The factors are referenced, not copied. Thus, they must outlive the product and mustn't be modified while the
+ * product is in use.
+ *
+ * Just like for the multiplication of permutations, the factors are applied from left to right, i.e. for the product
+ * a * b, FIRST a and THEN b is applied.
+ */
+class PermutationProduct {
+public:
+	using value_type = AbstractPermutation::value_type;
+
+	PermutationProduct() = default;
+	explicit PermutationProduct(const AbstractPermutation &factor);
+
+	/**
+	 * Appends the given factor, i.e. it is applied after all previous factors
+	 */
+	PermutationProduct &append(const AbstractPermutation &factor);
+
+	/**
+	 * @returns The amount of factors in this product
+	 */
+	std::size_t size() const;
+
+	/**
+	 * @returns Whether this product consists of no factors at all (and thus represents the identity)
+	 */
+	bool empty() const;
+
+	/**
+	 * @returns An upper bound for the biggest element that this product acts on
+	 */
+	value_type maxElement() const;
+
+	value_type image(value_type value) const;
+
+	int sign() const;
+
+	/**
+	 * @returns The permutation this product evaluates to
+	 */
+	ExplicitPermutation materialize() const;
+
+	/**
+	 * Stores the permutation this product evaluates to in destination. The memory already held by destination is
+	 * reused, so that no memory has to be allocated as long as its capacity suffices. destination mustn't be one of
+	 * the factors.
+	 */
+	void materializeInto(ExplicitPermutation &destination) const;
+
+	friend PermutationProduct operator*(const PermutationProduct &lhs, const AbstractPermutation &rhs);
+	friend PermutationProduct operator*(PermutationProduct &&lhs, const AbstractPermutation &rhs);
+
+protected:
+	std::vector< details::ProductFactor > m_factors;
+	value_type m_maxElement = 0;
+	bool m_negative         = false;
+};
+
+/**
+ * @returns A lazy product consisting of the given factors (applied from left to right)
+ */
+template< typename... Factors > PermutationProduct lazyProduct(const Factors &...factors) {
+	PermutationProduct product;
+
+	(product.append(factors), ...);
+
+	return product;
+}
+
+/**
+ * A product of generators that only stores the indices of the involved generators (a word in the generators). This is
+ * useful in algorithms that naturally express group elements in terms of generators (e.g. via Schreier vectors) as it
+ * avoids having to build the intermediate permutations.
+ *
+ * The generators are referenced, not copied. Thus, they must outlive the word and mustn't be modified while the word
+ * is in use.
+ *
+ * The generators referenced by the word are applied from left to right, i.e. FIRST the generator referenced by the
+ * first letter, then the one referenced by the second letter and so on.
+ */
+class PermutationWord {
+public:
+	using value_type = AbstractPermutation::value_type;
+
+	explicit PermutationWord(const std::vector< Permutation > &generators, std::vector< std::size_t > letters = {});
+
+	/**
+	 * Appends the generator with the given index to this word
+	 */
+	PermutationWord &append(std::size_t generatorIndex);
+
+	/**
+	 * @returns The indices of the generators that make up this word
+	 */
+	const std::vector< std::size_t > &letters() const;
+
+	/**
+	 * @returns The length of this word
+	 */
+	std::size_t size() const;
+
+	/**
+	 * @returns Whether this is the empty word (and thus represents the identity)
+	 */
+	bool empty() const;
+
+	/**
+	 * @returns An upper bound for the biggest element that this word acts on
+	 */
+	value_type maxElement() const;
+
+	value_type image(value_type value) const;
+
+	int sign() const;
+
+	/**
+	 * @returns The permutation this word evaluates to
+	 */
+	ExplicitPermutation materialize() const;
+
+	/**
+	 * Stores the permutation this word evaluates to in destination. The memory already held by destination is reused,
+	 * so that no memory has to be allocated as long as its capacity suffices. destination mustn't be one of the
+	 * generators.
+	 */
+	void materializeInto(ExplicitPermutation &destination) const;
+
+protected:
+	std::vector< details::ProductFactor > m_generators;
+	std::vector< std::size_t > m_letters;
+	value_type m_maxElement = 0;
+	bool m_negative         = false;
+};
+
+} // namespace perm
+
+#endif // LIBPERM_PERMUTATIONPRODUCT_HPP_
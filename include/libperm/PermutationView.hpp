@@ -0,0 +1,101 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_PERMUTATIONVIEW_HPP_
+#define LIBPERM_PERMUTATIONVIEW_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/Cycle.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace perm {
+
+namespace details {
+
+	/**
+	 * Common base class of permutation views. It refers to a caller-owned buffer holding the images of the points
+	 * 0, ..., n - 1 of some permutation and carries a sign on its own.
+	 *
+	 * Views are read-only: they can be used wherever a const AbstractPermutation is expected, but all functions that
+	 * would modify the permutation (except for setSign()) throw a std::logic_error.
+	 */
+	class PermutationViewBase : public AbstractPermutation {
+	public:
+		static constexpr const bool is_signed = true;
+
+		PermutationViewBase(const value_type *image, std::size_t size, int sign = 1);
+
+		value_type maxElement() const override;
+
+		int sign() const override;
+
+		void setSign(int sign) override;
+
+		void invert() override;
+
+		void preMultiply(const AbstractPermutation &other) override;
+
+		void postMultiply(const AbstractPermutation &other) override;
+
+		void shift(int shift, std::size_t startIndex = 0) override;
+
+		void insertIntoStream(std::ostream &stream) const override;
+
+	protected:
+		const value_type *m_image;
+		/**
+		 * The amount of viewed images, not counting trailing fixed points
+		 */
+		std::size_t m_size;
+		bool m_negative;
+	};
+
+} // namespace details
+
+/**
+ * A non-owning view of a permutation that is given by the images of the points 0, ..., n - 1, stored in a buffer owned
+ * by the caller. This allows to pass such permutations to library functions without having to copy them into an
+ * ExplicitPermutation first. The buffer has to outlive the view.
+ */
+class PermutationView : public details::PermutationViewBase {
+public:
+	PermutationView(const value_type *image, std::size_t size, int sign = 1);
+	explicit PermutationView(const std::vector< value_type > &image, int sign = 1);
+	// A view of a temporary buffer would immediately dangle
+	PermutationView(const std::vector< value_type > &&image, int sign = 1) = delete;
+
+	value_type image(value_type value) const override;
+
+	const value_type *contiguousImage() const override;
+
+	std::size_t hash() const override;
+
+	Cycle toCycle() const override;
+};
+
+/**
+ * A non-owning view of the inverse of a permutation that is given by the images of the points 0, ..., n - 1, stored in
+ * a buffer owned by the caller. The buffer has to outlive the view.
+ *
+ * Note: Looking up a single image requires a linear search through the buffer. Converting the view into a Cycle (as
+ * done e.g. by applyPermutation) is linear in the size of the buffer, though.
+ */
+class InversePermutationView : public details::PermutationViewBase {
+public:
+	InversePermutationView(const value_type *image, std::size_t size, int sign = 1);
+	explicit InversePermutationView(const std::vector< value_type > &image, int sign = 1);
+	// A view of a temporary buffer would immediately dangle
+	InversePermutationView(const std::vector< value_type > &&image, int sign = 1) = delete;
+
+	value_type image(value_type value) const override;
+
+	Cycle toCycle() const override;
+};
+
+} // namespace perm
+
+#endif // LIBPERM_PERMUTATIONVIEW_HPP_
@@ -8,20 +8,41 @@
 
 #include "libperm/AbstractPermutation.hpp"
 #include "libperm/AbstractPermutationGroup.hpp"
+#include "libperm/MemoryResource.hpp"
+#include "libperm/MultiplicationTable.hpp"
 #include "libperm/Permutation.hpp"
 
+#include <atomic>
+#include <cstddef>
 #include <initializer_list>
 #include <iosfwd>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <type_traits>
 #include <vector>
 
 namespace perm {
 
+/**
+ * A permutation group that is represented by explicitly storing all of its elements.
+ *
+ * The elements are generated lazily, that is only once they are needed by one of the queries (e.g. order or contains).
+ * Thus, constructing a group or changing its generators is cheap and generators that are added before the elements
+ * are needed, are all incorporated in a single extension step. Concurrent queries on a const group are thread-safe.
+ *
+ * The images of the generated elements (as well as the ones of computed cosets) are allocated from the memory resource
+ * that is given at construction. Using e.g. a monotonic buffer resource avoids lots of small heap allocations when
+ * generating big groups. The resource has to outlive the group and all cosets computed from it. It has to be
+ * thread-safe, if functions that accept a thread count are called with more than one thread (or if the group is
+ * queried from multiple threads).
+ */
 class PrimitivePermutationGroup : public AbstractPermutationGroup {
 public:
 	PrimitivePermutationGroup();
+	explicit PrimitivePermutationGroup(pmr::memory_resource *resource);
 	PrimitivePermutationGroup(std::vector< Permutation > generators);
+	PrimitivePermutationGroup(std::vector< Permutation > generators, pmr::memory_resource *resource);
 
 	template< typename Iterator, typename Perm = typename std::iterator_traits< Iterator >::value_type >
 	PrimitivePermutationGroup(Iterator begin, Iterator end) : PrimitivePermutationGroup() {
@@ -39,11 +60,65 @@ public:
 		setGenerators(std::move(generators));
 	}
 
-	PrimitivePermutationGroup(const PrimitivePermutationGroup &) = default;
-	PrimitivePermutationGroup(PrimitivePermutationGroup &&)      = default;
-
-	PrimitivePermutationGroup &operator=(const PrimitivePermutationGroup &) = default;
-	PrimitivePermutationGroup &operator=(PrimitivePermutationGroup &&) = default;
+	PrimitivePermutationGroup(const PrimitivePermutationGroup &other);
+	PrimitivePermutationGroup(PrimitivePermutationGroup &&other);
+
+	PrimitivePermutationGroup &operator=(const PrimitivePermutationGroup &other);
+	PrimitivePermutationGroup &operator=(PrimitivePermutationGroup &&other);
+
+	/**
+	 * Sets the amount of threads that are used for generating the elements of this group (0 means as many as there
+	 * are hardware threads). Defaults to 1. Note that more than one thread requires a thread-safe memory resource.
+	 */
+	void setThreadCount(std::size_t threadCount);
+
+	/**
+	 * @returns The amount of threads that are used for generating the elements of this group
+	 */
+	std::size_t threadCount() const;
+
+	/**
+	 * @returns The memory resource the images of this group's elements are allocated from
+	 */
+	pmr::memory_resource *resource() const;
+
+	/**
+	 * Shifts all points this group acts on (see AbstractPermutation::shift). The already generated elements are
+	 * transformed in-place, so the group is not regenerated.
+	 *
+	 * @param shift The amount of shift that shall be applied
+	 * @param startIndex Only shift points that are greater or equal to this
+	 */
+	void shift(int shift, std::size_t startIndex = 0);
+
+	/**
+	 * Conjugates this group by the given permutation g, that is the group G is replaced by g^{-1} G g (where the
+	 * product is applied left-to-right). This corresponds to relabelling every point i as g(i). The already generated
+	 * elements are transformed in-place, so the group is not regenerated.
+	 */
+	void conjugate(const AbstractPermutation &perm);
+
+	/**
+	 * Removes the given points from the set of points this group acts on. All bigger points are moved down
+	 * accordingly. The already generated elements are transformed in-place, so the group is not regenerated.
+	 *
+	 * @param points The points to remove. Every one of them must be a fixed point of all elements of this group.
+	 */
+	void removeFixedPoints(std::vector< AbstractPermutation::value_type > points);
+
+	/**
+	 * Constructs the direct product of the two given groups. Instead of running Dimino's algorithm, the elements of
+	 * the product are directly obtained as all products of an element of lhs with an element of rhs (which can be
+	 * parallelized for big groups).
+	 *
+	 * @param lhs The first factor
+	 * @param rhs The second factor. Must act on points that are disjoint from the ones that lhs acts on.
+	 * @param threadCount The amount of threads to use for computing the products (0 means as many as there are
+	 * hardware threads). The images are allocated from the resource of lhs concurrently, if this is not 1.
+	 * @returns The direct product of lhs and rhs
+	 */
+	static PrimitivePermutationGroup directProduct(const PrimitivePermutationGroup &lhs,
+												   const PrimitivePermutationGroup &rhs, std::size_t threadCount = 1);
 
 
 	virtual std::vector< AbstractPermutation::value_type >
@@ -53,14 +128,30 @@ public:
 
 	virtual bool contains(const AbstractPermutation &perm) const override final;
 
+	/**
+	 * Adds the given generator to this group, if it is not already contained in it. As this check requires the group's
+	 * elements, they are generated (if that hasn't happened yet). Use addGenerators to add multiple generators without
+	 * generating the elements in-between.
+	 */
 	virtual bool addGenerator(Permutation perm) override final;
 
+	/**
+	 * Adds the given generators to this group without checking whether they are redundant (apart from exact
+	 * duplicates of existing generators). The extension of the group is deferred until its elements are needed, so
+	 * that generators added by multiple calls are incorporated at once.
+	 */
+	void addGenerators(std::vector< Permutation > generators);
+
 	virtual void setGenerators(std::vector< Permutation > generators) override final;
 
 	virtual const std::vector< Permutation > &getGenerators() const override final;
 
 	virtual void getElementsTo(std::vector< Permutation > &permutations) const override final;
 
+	virtual std::size_t rank(const AbstractPermutation &perm) const override final;
+
+	virtual Permutation unrank(std::size_t rank) const override final;
+
 	virtual std::vector< Permutation > leftCoset(const AbstractPermutation &perm) const override final;
 
 	virtual std::vector< Permutation > rightCoset(const AbstractPermutation &perm) const override final;
@@ -69,13 +160,84 @@ public:
 
 	virtual Permutation rightCosetRepresentative(const AbstractPermutation &perm) const override;
 
+	/**
+	 * @returns The element at the given index. The indices refer to the order in which getElementsTo returns the
+	 * elements.
+	 */
+	const Permutation &element(std::size_t index) const;
+
+	/**
+	 * @returns The index of the given permutation among this group's elements or order(), if it is not contained in
+	 * this group. The lookup is a binary search in an index of the elements that is built once and reused afterwards.
+	 */
+	std::size_t indexOf(const AbstractPermutation &perm) const;
+
+	/**
+	 * @returns The table whose entry (i, k) is the index of the product element(i) * getGenerators()[k] (applying
+	 * element(i) first). It is computed once, when first requested, and remains valid until this group is modified.
+	 *
+	 * @param threadCount The amount of threads to use for computing the table (0 means as many as there are hardware
+	 * threads). Has no effect, if the table has already been computed.
+	 */
+	const MultiplicationTable &generatorTable(std::size_t threadCount = 1) const;
+
+	/**
+	 * @returns The Cayley table of this group, i.e. the table whose entry (i, j) is the index of the product
+	 * element(i) * element(j) (applying element(i) first). It is derived from the generator table without composing
+	 * any permutations, but it requires memory quadratic in the group's order. Thus, it should only be requested for
+	 * groups with at most a few thousand elements. It remains valid until this group is modified.
+	 *
+	 * @param threadCount The amount of threads to use for computing the table (as well as the generator table, if that
+	 * hasn't been computed yet). 0 means as many as there are hardware threads.
+	 */
+	const MultiplicationTable &cayleyTable(std::size_t threadCount = 1) const;
+
 	friend std::ostream &operator<<(std::ostream &stream, const PrimitivePermutationGroup &group);
 
 protected:
 	std::vector< Permutation > m_generators;
-	std::vector< Permutation > m_elements;
-
-	void regenerateGroup();
+	/**
+	 * The (lazily generated) elements of this group. The storage is shared between copies of a group and therefore
+	 * must never be modified while it is shared (copy-on-write).
+	 */
+	mutable std::shared_ptr< std::vector< Permutation > > m_elements;
+	/**
+	 * The amount of generators (counted from the front) that have already been incorporated into m_elements
+	 */
+	mutable std::size_t m_includedGenerators = 0;
+	mutable std::atomic_bool m_materialized{ false };
+	mutable std::mutex m_materializationMutex;
+	/**
+	 * The indices of the elements sorted by element (in the order established by compare()), used for looking up
+	 * element indices. Like the multiplication tables, this is computed on demand and shared between copies.
+	 */
+	mutable std::shared_ptr< const std::vector< MultiplicationTable::index_type > > m_sortedIndices;
+	mutable std::shared_ptr< const MultiplicationTable > m_generatorTable;
+	mutable std::shared_ptr< const MultiplicationTable > m_cayleyTable;
+	pmr::memory_resource *m_resource = pmr::get_default_resource();
+	std::size_t m_threadCount        = 1;
+
+	/**
+	 * Ensures that m_elements contains all elements generated by the current generators
+	 */
+	void materialize() const;
+	/**
+	 * @returns All elements of this group (generating them, if necessary)
+	 */
+	const std::vector< Permutation > &elements() const;
+	/**
+	 * @returns The currently generated elements in a form that is safe to be modified. If the storage is shared with
+	 * other groups, it is copied first.
+	 */
+	std::vector< Permutation > &mutableElements() const;
+	/**
+	 * Discards the element index and the multiplication tables, as they are no longer valid
+	 */
+	void resetTables() const;
+	/**
+	 * @returns The element index (computing it, if necessary). Must be called with m_materializationMutex held.
+	 */
+	const std::vector< MultiplicationTable::index_type > &sortedIndices() const;
 	void sortRepresentation();
 };
 
@@ -0,0 +1,65 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_SERIALIZATION_HPP_
+#define LIBPERM_SERIALIZATION_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/ExplicitPermutation.hpp"
+#include "libperm/Permutation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/*
+ * Compact binary representation of permutations. Every number is stored as a LEB128-style varint (7 bits per byte,
+ * least significant group first, the high bit marking that more bytes follow) so that small point indices take up a
+ * single byte, independent of the size of AbstractPermutation::value_type.
+ *
+ * A single permutation is stored as
+ * - varint (n << 1) | s, where n is one past the largest point that is moved by the permutation (0 for the identity)
+ *   and s is 1 for negative and 0 for positive signs
+ * - n varints holding the images of the points 0, ..., n - 1
+ *
+ * A batch of permutations is stored as a varint holding the amount of permutations, followed by the permutations
+ * themselves.
+ *
+ * The representation doesn't depend on the byte order of the machine it has been created on.
+ */
+
+namespace perm {
+
+/**
+ * Appends the compact binary representation of the given permutation to the given buffer
+ */
+void serialize(const AbstractPermutation &perm, std::vector< std::uint8_t > &buffer);
+
+/**
+ * Appends the compact binary representation of the given batch of permutations to the given buffer
+ */
+void serialize(const std::vector< Permutation > &perms, std::vector< std::uint8_t > &buffer);
+
+/**
+ * Reads a single permutation from the given data, starting at the given offset. On success, the offset is advanced
+ * past the read permutation.
+ *
+ * @returns The read permutation or an empty optional, if the data doesn't hold a valid permutation at the given offset
+ */
+std::optional< ExplicitPermutation > deserialize(const std::uint8_t *data, std::size_t size, std::size_t &offset);
+
+/**
+ * Reads a batch of permutations from the given data, starting at the given offset, and appends them to the given list.
+ * On success, the offset is advanced past the read batch. On failure, neither the offset nor the list are changed.
+ *
+ * @returns Whether the data holds a valid batch of permutations at the given offset
+ */
+bool deserializeTo(const std::uint8_t *data, std::size_t size, std::size_t &offset,
+				   std::vector< Permutation > &perms);
+
+} // namespace perm
+
+#endif // LIBPERM_SERIALIZATION_HPP_
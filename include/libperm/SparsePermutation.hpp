@@ -0,0 +1,103 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_SPARSEPERMUTATION_HPP_
+#define LIBPERM_SPARSEPERMUTATION_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/Cycle.hpp"
+#include "libperm/details/SignedPermutation.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace perm {
+
+/**
+ * A permutation that only stores the points it actually moves (together with their images), sorted by point. Thus,
+ * its memory consumption and the cost of composition, inversion, shifting and comparison with other sparse
+ * permutations only depend on the size of its support, instead of on the biggest point it acts on. This makes it the
+ * better choice over ExplicitPermutation for permutations acting on big domains while only moving a few points.
+ * Looking up the image of a single point takes O(log(support)).
+ */
+class SparsePermutation : public details::SignedPermutation {
+public:
+	/**
+	 * A moved point and its image
+	 */
+	using mapping_type = std::pair< value_type, value_type >;
+
+	explicit SparsePermutation(int sign = 1);
+	/**
+	 * @param mapping The images of (at least) all points moved by the to-be-constructed perm. The order of the entries
+	 * doesn't matter and entries mapping a point to itself are ignored.
+	 */
+	explicit SparsePermutation(std::vector< mapping_type > mapping, int sign = 1);
+	SparsePermutation(const Cycle &cycle, int sign = 1);
+	/**
+	 * Creates a sparse representation of the given permutation
+	 */
+	explicit SparsePermutation(const AbstractPermutation &perm);
+	SparsePermutation(const SparsePermutation &other) = default;
+	SparsePermutation(SparsePermutation &&other)      = default;
+	~SparsePermutation()                              = default;
+	SparsePermutation &operator=(const SparsePermutation &other) = default;
+	SparsePermutation &operator=(SparsePermutation &&other) = default;
+
+	value_type maxElement() const override;
+
+	value_type image(value_type value) const override;
+
+	/**
+	 * @returns The moved points together with their images, sorted by point
+	 */
+	const std::vector< mapping_type > &mapping() const;
+
+	/**
+	 * @returns The amount of points moved by this permutation
+	 */
+	std::size_t supportSize() const;
+
+	bool isIdentity() const override;
+
+	void invert() override;
+
+	void preMultiply(const AbstractPermutation &other) override;
+
+	void postMultiply(const AbstractPermutation &other) override;
+
+	bool equals(const AbstractPermutation &other) const override;
+
+	Cycle toCycle() const override;
+
+	void shift(int shift, std::size_t startIndex = 0) override;
+
+	void insertIntoStream(std::ostream &stream) const override;
+
+protected:
+	std::vector< mapping_type > m_mapping;
+
+	/**
+	 * Replaces this permutation by the one that maps every point p to outer(inner(p))
+	 */
+	void compose(const AbstractPermutation &inner, const AbstractPermutation &outer);
+
+	/**
+	 * Sorts the stored mapping and removes entries that map a point to itself
+	 */
+	void normalize();
+};
+
+} // namespace perm
+
+namespace std {
+
+template<> struct hash< perm::SparsePermutation > : hash< perm::AbstractPermutation > {};
+
+} // namespace std
+
+#endif // LIBPERM_SPARSEPERMUTATION_HPP_
@@ -7,12 +7,16 @@
 #define LIBPERM_SPECIALGROUPS_HPP_
 
 #include "libperm/Cycle.hpp"
+#include "libperm/CyclicGroup.hpp"
+#include "libperm/DihedralGroup.hpp"
 #include "libperm/ExplicitPermutation.hpp"
 #include "libperm/Permutation.hpp"
 #include "libperm/PrimitivePermutationGroup.hpp"
+#include "libperm/YoungSubgroup.hpp"
 
 #include <cassert>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -30,6 +34,11 @@ template< typename Group = PrimitivePermutationGroup, typename Perm = ExplicitPe
 		return Group{};
 	}
 
+	if constexpr (std::is_same_v< Group, YoungSubgroup >) {
+		// A Young subgroup can represent the symmetric group directly (without the need for any generators)
+		return YoungSubgroup({ { 0, n - 1 } });
+	}
+
 	// The symmetric group over n elements can be generated by the cycle (0 1 2 ... n-1)
 	// and the cycle (0 1)
 
@@ -43,7 +52,63 @@ template< typename Group = PrimitivePermutationGroup, typename Perm = ExplicitPe
 }
 
 /**
- * Generates a group that describes antisymmetric pairwise exchanges of elements within each of the provided ranges
+ * @param n The amount of elements the generated group shall act on
+ * @returns The cyclic group over n elements, that is the group of all rotations of the elements 0..n-1 arranged on a
+ * ring
+ *
+ * @tparam Group The type of the group object that is to be generated
+ * @tparam Perm The type of the permutation object that is used for the generators
+ */
+template< typename Group = CyclicGroup, typename Perm = ExplicitPermutation > Group Cyclic(unsigned int n) {
+	if constexpr (std::is_same_v< Group, CyclicGroup >) {
+		return CyclicGroup(n);
+	} else {
+		if (n == 0 || n == 1) {
+			return Group{};
+		}
+
+		// The cyclic group is generated by the rotation (0 1 2 ... n-1)
+		std::vector< Cycle::value_type > cycle(n);
+		std::iota(cycle.begin(), cycle.end(), 0);
+
+		return Group({ Perm(Cycle(std::move(cycle))) });
+	}
+}
+
+/**
+ * @param n The amount of elements the generated group shall act on
+ * @returns The dihedral group over n elements, that is the group of all rotations and reflections of the elements
+ * 0..n-1 arranged on a ring
+ *
+ * @tparam Group The type of the group object that is to be generated
+ * @tparam Perm The type of the permutation object that is used for the generators
+ */
+template< typename Group = DihedralGroup, typename Perm = ExplicitPermutation > Group Dihedral(unsigned int n) {
+	if constexpr (std::is_same_v< Group, DihedralGroup >) {
+		return DihedralGroup(n);
+	} else {
+		if (n == 0 || n == 1) {
+			return Group{};
+		}
+
+		// The dihedral group is generated by the rotation (0 1 2 ... n-1) and the reflection i -> n - i
+		std::vector< Cycle::value_type > cycle(n);
+		std::iota(cycle.begin(), cycle.end(), 0);
+
+		std::vector< std::vector< Cycle::value_type > > reflection;
+		for (Cycle::value_type i = 1; i < n - i; ++i) {
+			reflection.push_back({ i, n - i });
+		}
+
+		return Group({ Perm(Cycle(std::move(cycle))), Perm(Cycle(std::move(reflection))) });
+	}
+}
+
+/**
+ * Generates a group that describes antisymmetric pairwise exchanges of elements within each of the provided ranges.
+ * Requesting a YoungSubgroup as the group type yields a structured representation of this group that doesn't need to
+ * explicitly enumerate its elements.
+ *
  * @param ranges The list of ranges to generate the group for. The list contains pairs of the form {from, to} where
  * from <= to and both from and to are understood to be inclusive.
  *
@@ -56,6 +121,10 @@ Group antisymmetricRanges(const std::vector< std::pair< Cycle::value_type, Cycle
 		return Group{};
 	}
 
+	if constexpr (std::is_same_v< Group, YoungSubgroup >) {
+		return YoungSubgroup(ranges, true);
+	}
+
 	std::vector< Permutation > generators;
 
 	for (const std::pair< Cycle::value_type, Cycle::value_type > &currentRange : ranges) {
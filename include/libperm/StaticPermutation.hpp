@@ -0,0 +1,164 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_STATICPERMUTATION_HPP_
+#define LIBPERM_STATICPERMUTATION_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/PermutationView.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+
+namespace perm {
+
+/**
+ * A signed permutation of the points 0, ..., N - 1 whose image is stored in a fixed-size array. All of its operations
+ * are constexpr, so that permutations of index structures that are known at compile time (and groups generated by
+ * them, see StaticPermutationGroup) can be computed by the compiler. It doesn't derive from AbstractPermutation, which
+ * avoids virtual dispatch, but view() makes it usable with all functions expecting an AbstractPermutation.
+ *
+ * @tparam N The amount of points the permutation acts on
+ */
+template< std::size_t N > class StaticPermutation {
+public:
+	using value_type = AbstractPermutation::value_type;
+	using image_type = std::array< value_type, N >;
+
+	static constexpr const bool is_signed = true;
+
+	/**
+	 * Constructs a permutation from the given (disjoint) cycles, e.g. fromCycles({ { 0, 1 }, { 2, 3 } })
+	 */
+	static constexpr StaticPermutation fromCycles(std::initializer_list< std::initializer_list< value_type > > cycles,
+												  int sign = 1) {
+		StaticPermutation perm(sign);
+
+		for (const std::initializer_list< value_type > &currentCycle : cycles) {
+			const value_type *points = currentCycle.begin();
+
+			for (std::size_t i = 0; i < currentCycle.size(); ++i) {
+				assert(points[i] < N);
+
+				perm.m_image[points[i]] = points[(i + 1) % currentCycle.size()];
+			}
+		}
+
+		return perm;
+	}
+
+	constexpr StaticPermutation() : StaticPermutation(1) {}
+
+	constexpr explicit StaticPermutation(int sign) : m_image(), m_negative(sign < 0) {
+		assert(sign == 1 || sign == -1);
+
+		for (std::size_t i = 0; i < N; ++i) {
+			m_image[i] = static_cast< value_type >(i);
+		}
+	}
+
+	constexpr explicit StaticPermutation(const image_type &image, int sign = 1)
+		: m_image(image), m_negative(sign < 0) {
+		assert(sign == 1 || sign == -1);
+	}
+
+	constexpr value_type image(value_type value) const { return value < N ? m_image[value] : value; }
+
+	constexpr value_type operator[](value_type value) const { return image(value); }
+
+	/**
+	 * @returns The images of the points 0, ..., N - 1
+	 */
+	constexpr const image_type &images() const { return m_image; }
+
+	constexpr int sign() const { return m_negative ? -1 : 1; }
+
+	constexpr void setSign(int sign) { m_negative = sign < 0; }
+
+	constexpr bool isIdentity() const { return !m_negative && *this == StaticPermutation(); }
+
+	constexpr void invert() { *this = inverse(); }
+
+	constexpr StaticPermutation inverse() const {
+		StaticPermutation inverse(sign());
+
+		for (std::size_t i = 0; i < N; ++i) {
+			inverse.m_image[m_image[i]] = static_cast< value_type >(i);
+		}
+
+		return inverse;
+	}
+
+	/**
+	 * Replaces this permutation by the one that applies other first and then this permutation
+	 */
+	constexpr void preMultiply(const StaticPermutation &other) { *this = other * *this; }
+
+	/**
+	 * Replaces this permutation by the one that applies this permutation first and then other
+	 */
+	constexpr void postMultiply(const StaticPermutation &other) { *this = *this * other; }
+
+	/**
+	 * @returns The product that applies lhs first and then rhs
+	 */
+	friend constexpr StaticPermutation operator*(const StaticPermutation &lhs, const StaticPermutation &rhs) {
+		StaticPermutation product(lhs.sign() * rhs.sign());
+
+		for (std::size_t i = 0; i < N; ++i) {
+			product.m_image[i] = rhs.m_image[lhs.m_image[i]];
+		}
+
+		return product;
+	}
+
+	friend constexpr bool operator==(const StaticPermutation &lhs, const StaticPermutation &rhs) {
+		if (lhs.m_negative != rhs.m_negative) {
+			return false;
+		}
+
+		for (std::size_t i = 0; i < N; ++i) {
+			if (lhs.m_image[i] != rhs.m_image[i]) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	friend constexpr bool operator!=(const StaticPermutation &lhs, const StaticPermutation &rhs) {
+		return !(lhs == rhs);
+	}
+
+	/**
+	 * Orders permutations lexicographically by the images of 0, 1, 2, ... and permutations with equal images by their
+	 * sign (negative first), just as perm::compare does.
+	 */
+	friend constexpr bool operator<(const StaticPermutation &lhs, const StaticPermutation &rhs) {
+		for (std::size_t i = 0; i < N; ++i) {
+			if (lhs.m_image[i] != rhs.m_image[i]) {
+				return lhs.m_image[i] < rhs.m_image[i];
+			}
+		}
+
+		return lhs.m_negative && !rhs.m_negative;
+	}
+
+	/**
+	 * @returns A view of this permutation that can be passed to all functions expecting an AbstractPermutation. It
+	 * must not outlive this object.
+	 */
+	PermutationView view() const { return PermutationView(m_image.data(), N, sign()); }
+
+protected:
+	image_type m_image;
+	bool m_negative;
+};
+
+} // namespace perm
+
+#endif // LIBPERM_STATICPERMUTATION_HPP_
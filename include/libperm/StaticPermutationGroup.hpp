@@ -0,0 +1,264 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_STATICPERMUTATIONGROUP_HPP_
+#define LIBPERM_STATICPERMUTATIONGROUP_HPP_
+
+#include "libperm/StaticPermutation.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace perm {
+
+/**
+ * A permutation group of the points 0, ..., N - 1 whose Order elements are stored in a fixed-size array. Instances are
+ * meant to be created at compile time via staticGroup, so that queries don't depend on any runtime group generation,
+ * virtual dispatch or heap memory.
+ *
+ * The elements are stored in the order in which they have been discovered (starting with the identity), which is
+ * deterministic.
+ *
+ * @tparam N The amount of points the group acts on
+ * @tparam Order The order of the group
+ */
+template< std::size_t N, std::size_t Order > class StaticPermutationGroup {
+public:
+	using permutation_type = StaticPermutation< N >;
+	using element_list     = std::array< permutation_type, Order >;
+
+	constexpr explicit StaticPermutationGroup(const element_list &elements) : m_elements(elements) {}
+
+	constexpr std::size_t order() const { return Order; }
+
+	constexpr const element_list &elements() const { return m_elements; }
+
+	constexpr typename element_list::const_iterator begin() const { return m_elements.begin(); }
+	constexpr typename element_list::const_iterator end() const { return m_elements.end(); }
+
+	constexpr bool contains(const permutation_type &perm) const {
+		for (const permutation_type &current : m_elements) {
+			if (current == perm) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Computes the element g of this group for which the range permuted by g (see applyPermutation) is the
+	 * lexicographically smallest one. Since all sequences that are interconvertible by an element of this group yield
+	 * the same smallest range, this is a canonicalization permutation. It only requires looking up the elements of this
+	 * group.
+	 *
+	 * @param begin Iterator to the begin of the range, which has to consist of exactly N elements
+	 * @param end Iterator to the end of the range
+	 * @param cmp The comparator used to compare the permuted ranges
+	 * @returns The computed permutation (out of the elements of this group)
+	 */
+	template< typename Iterator,
+			  typename Compare = std::less< typename std::iterator_traits< Iterator >::value_type > >
+	const permutation_type &computeCanonicalizationPermutation(Iterator begin, Iterator end, Compare cmp = {}) const {
+		assert(static_cast< std::size_t >(std::distance(begin, end)) == N);
+		(void) end;
+
+		const permutation_type *best = &m_elements[0];
+
+		for (const permutation_type &current : m_elements) {
+			for (std::size_t i = 0; i < N; ++i) {
+				const auto &currentValue = begin[current.images()[i]];
+				const auto &bestValue    = begin[best->images()[i]];
+
+				if (cmp(currentValue, bestValue)) {
+					best = &current;
+					break;
+				} else if (cmp(bestValue, currentValue)) {
+					break;
+				}
+			}
+		}
+
+		return *best;
+	}
+
+	/**
+	 * Brings the given range into the canonical order (see computeCanonicalizationPermutation) in-place
+	 *
+	 * @returns The sign of the permutation that was used to reorder the elements
+	 */
+	template< typename Iterator,
+			  typename Compare = std::less< typename std::iterator_traits< Iterator >::value_type > >
+	int canonicalize(Iterator begin, Iterator end, Compare cmp = {}) const {
+		static_assert(!std::is_const_v< typename std::iterator_traits< Iterator >::value_type >,
+					  "Can't canonicalize a range of const elements");
+
+		const permutation_type &canonicalizer = computeCanonicalizationPermutation(begin, end, cmp);
+
+		// Follow the cycles of the canonicalizer, so that position i receives the element at position canonicalizer(i)
+		std::array< bool, N > processed{};
+		for (std::size_t start = 0; start < N; ++start) {
+			if (processed[start] || canonicalizer.images()[start] == start) {
+				continue;
+			}
+
+			auto displaced = std::move(begin[start]);
+
+			std::size_t current = start;
+			while (canonicalizer.images()[current] != start) {
+				const std::size_t next = canonicalizer.images()[current];
+
+				begin[current]     = std::move(begin[next]);
+				processed[current] = true;
+				current            = next;
+			}
+
+			begin[current]     = std::move(displaced);
+			processed[current] = true;
+		}
+
+		return canonicalizer.sign();
+	}
+
+	/**
+	 * Brings the elements in the given container into the canonical order
+	 *
+	 * @returns The sign of the permutation that was used to reorder the elements
+	 */
+	template< typename Container, typename Compare = std::less< typename Container::value_type > >
+	int canonicalize(Container &container, Compare cmp = {}) const {
+		return canonicalize(std::begin(container), std::end(container), cmp);
+	}
+
+protected:
+	element_list m_elements;
+};
+
+namespace details {
+
+	/**
+	 * Called if a statically generated group turns out to contain more elements than fit into the used buffer. As this
+	 * function is not constexpr, this turns the generation into a compile-time error.
+	 */
+	inline void staticGroupCapacityExceeded() {
+	}
+
+	/**
+	 * The permutation type of the generators given by Generators::generators
+	 */
+	template< typename Generators >
+	using static_generator_type = typename std::decay_t< decltype(Generators::generators) >::value_type;
+
+	/**
+	 * The amount of points the generators given by Generators::generators act on
+	 */
+	template< typename Generators >
+	inline constexpr std::size_t staticPointCount =
+		std::tuple_size_v< typename static_generator_type< Generators >::image_type >;
+
+	constexpr std::size_t staticGroupDefaultCapacity(std::size_t n) {
+		// N! is an upper bound on the order, but generating groups with more than 8! elements at compile time isn't
+		// feasible anyway
+		std::size_t capacity = 1;
+		for (std::size_t i = 2; i <= n && i <= 8; ++i) {
+			capacity *= i;
+		}
+
+		return capacity;
+	}
+
+	template< std::size_t N, std::size_t Capacity > struct StaticGroupBuffer {
+		std::array< StaticPermutation< N >, Capacity > elements{};
+		std::size_t size = 0;
+	};
+
+	/**
+	 * Enumerates all elements of the group generated by the given generators, by multiplying every discovered element
+	 * with all generators until no new elements show up. The identity is always the first element.
+	 */
+	template< std::size_t Capacity, std::size_t N, std::size_t GeneratorCount >
+	constexpr StaticGroupBuffer< N, Capacity >
+		enumerateStaticGroup(const std::array< StaticPermutation< N >, GeneratorCount > &generators) {
+		StaticGroupBuffer< N, Capacity > buffer;
+		buffer.elements[buffer.size++] = StaticPermutation< N >();
+
+		for (std::size_t i = 0; i < buffer.size; ++i) {
+			for (const StaticPermutation< N > &currentGenerator : generators) {
+				const StaticPermutation< N > candidate = buffer.elements[i] * currentGenerator;
+
+				bool known = false;
+				for (std::size_t j = 0; j < buffer.size && !known; ++j) {
+					known = buffer.elements[j] == candidate;
+				}
+
+				if (!known) {
+					if (buffer.size == Capacity) {
+						staticGroupCapacityExceeded();
+						return buffer;
+					}
+
+					buffer.elements[buffer.size++] = candidate;
+				}
+			}
+		}
+
+		return buffer;
+	}
+
+	template< typename Generators, std::size_t Capacity, std::size_t Order >
+	constexpr auto makeStaticGroup() {
+		using permutation_type = static_generator_type< Generators >;
+
+		constexpr auto buffer = enumerateStaticGroup< Capacity >(Generators::generators);
+
+		std::array< permutation_type, Order > elements{};
+		for (std::size_t i = 0; i < Order; ++i) {
+			elements[i] = buffer.elements[i];
+		}
+
+		return StaticPermutationGroup< staticPointCount< Generators >, Order >(elements);
+	}
+
+} // namespace details
+
+/**
+ * @returns The order of the group generated by Generators::generators (see staticGroup)
+ */
+template< typename Generators,
+		  std::size_t Capacity = details::staticGroupDefaultCapacity(details::staticPointCount< Generators >) >
+inline constexpr std::size_t staticGroupOrder = details::enumerateStaticGroup< Capacity >(Generators::generators).size;
+
+/**
+ * The group generated by the generators given as Generators::generators (a constexpr std::array of StaticPermutation
+ * objects), enumerated at compile time. E.g.
+ * @code
+ * struct RiemannSymmetry {
+ *     static constexpr std::array< StaticPermutation< 4 >, 2 > generators = {
+ *         StaticPermutation< 4 >::fromCycles({ { 0, 1 } }, -1), StaticPermutation< 4 >::fromCycles({ { 0, 2 }, { 1, 3 } })
+ *     };
+ * };
+ *
+ * constexpr const auto &riemannGroup = staticGroup< RiemannSymmetry >;
+ * @endcode
+ *
+ * Enumerating a group at compile time takes time quadratic in its order, so this is meant for small groups.
+ *
+ * @tparam Generators A type providing the generators as a static constexpr member called generators
+ * @tparam Capacity An upper bound on the group's order. Exceeding it is a compile-time error.
+ */
+template< typename Generators,
+		  std::size_t Capacity = details::staticGroupDefaultCapacity(details::staticPointCount< Generators >) >
+inline constexpr auto staticGroup =
+	details::makeStaticGroup< Generators, Capacity, staticGroupOrder< Generators, Capacity > >();
+
+} // namespace perm
+
+#endif // LIBPERM_STATICPERMUTATIONGROUP_HPP_
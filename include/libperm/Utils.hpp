@@ -9,8 +9,11 @@
 #include "libperm/AbstractPermutation.hpp"
 #include "libperm/AbstractPermutationGroup.hpp"
 #include "libperm/Cycle.hpp"
+#include "libperm/DirectProductGroup.hpp"
 #include "libperm/ExplicitPermutation.hpp"
 #include "libperm/Permutation.hpp"
+#include "libperm/PrimitivePermutationGroup.hpp"
+#include "libperm/details/GeneratorRestriction.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -19,8 +22,6 @@
 #include <type_traits>
 #include <vector>
 
-#include <iostream>
-
 namespace perm {
 
 namespace {
@@ -33,7 +34,7 @@ namespace {
 					  "Can only process random-access iterators");
 
 		assert(std::distance(begin, end) >= 0);
-		std::vector< ExplicitPermutation::value_type > image(static_cast< std::size_t >(std::distance(begin, end)));
+		ExplicitPermutation::image_type image(static_cast< std::size_t >(std::distance(begin, end)));
 		std::iota(image.begin(), image.end(), 0);
 
 		const auto cmpFunc = [&](ExplicitPermutation::value_type lhs, ExplicitPermutation::value_type rhs) {
@@ -172,7 +173,7 @@ void applyPermutation(Iterator begin, Iterator end, const Permutation &perm) {
 		}
 	}();
 
-	for (const std::vector< Cycle::value_type > &currentCycle : cycles) {
+	for (const Cycle::Span currentCycle : cycles) {
 		assert(!currentCycle.empty());
 		Cycle::value_type baseIndex = currentCycle[0];
 
@@ -236,8 +237,6 @@ Permutation computeCanonicalizationPermutation(Iterator begin, Iterator end, con
 	// sequence with respect to the provided comparator fulfills this need.
 	const ExplicitPermutation sortPermutation = computeStableSortPermutation(begin, end, cmp);
 
-	std::cout << "Sort permutation: " << sortPermutation << std::endl;
-
 	// The canonicalization idea is this: Determine a way to permute the standard configuration into the searched-for
 	// canonical order of elements for the provided sequence. We can achieve this by considering how to reach the
 	// current sequence of elements from the standard configuration
@@ -245,12 +244,6 @@ Permutation computeCanonicalizationPermutation(Iterator begin, Iterator end, con
 	ExplicitPermutation cosetGenerator = sortPermutation;
 	cosetGenerator.invert();
 
-	auto rightCoset = group.rightCoset(cosetGenerator);
-	std::cout << "Right coset:\n";
-	for (auto current : rightCoset) {
-		std::cout << "  " << current << "\n";
-	}
-
 	// This we can then use to generate the left coset with the provided group, which will always be the same
 	// for starting configurations that can be transformed into each other using the elements of the provided group
 	// (and different in the other case).
@@ -258,8 +251,6 @@ Permutation computeCanonicalizationPermutation(Iterator begin, Iterator end, con
 	// of the coset's order)
 	Permutation canonicalization = group.rightCosetRepresentative(cosetGenerator);
 
-	std::cout << "Canonical representative: " << canonicalization << "\n\n";
-
 	// Since we want to apply the canonicalization permutation to the original sequence rather than the standard
 	// configuration, we first have to (formally) transform the current sequence into the standard configuration, which
 	// we achieve by applying the determined sort permutation as a first step.
@@ -335,6 +326,9 @@ int canonicalize(Container &container, const PermGroup &group, Compare cmp = {})
  * elements will be removed as well and the elements that involve elements after ones that have been excluded are
  * modified to account for the shift to lower indices (due to one or more elements to their left having been removed).
  *
+ * If a DirectProductGroup is requested as the resulting group type, the given groups are kept as the factors of the
+ * produced group instead of regenerating the concatenated group from its generators.
+ *
  * @param lhs The permutation group describing the symmetries of the lhs sequence
  * @param lhsSize The amount of retained elements (e.g. those that are not excluded) in the lhs sequence
  * @param rhs The permutation group describing the symmetries of the rhs sequence
@@ -351,88 +345,61 @@ PermGroup concatenate(const AbstractPermutationGroup &lhs, std::size_t lhsSize,
 	static_assert(std::is_integral_v< typename Container::value_type >, "Excludes are expected to be indices");
 	static_assert(std::is_unsigned_v< typename Container::value_type >, "Excludes are expected to be indices");
 
-	std::vector< Permutation > generators;
-
-	// Fetch and adapt generators from lhs
-	std::vector< std::size_t > excludedIndices(lhsExcludes.begin(), lhsExcludes.end());
-	std::sort(excludedIndices.begin(), excludedIndices.end());
-
-	for (const Permutation &currentPerm : lhs.getGenerators()) {
-		if (currentPerm->isIdentity()) {
-			continue;
-		}
-
-		bool include = true;
-
-		for (auto currentExclude : excludedIndices) {
-			if (currentPerm->image(static_cast< AbstractPermutation::value_type >(currentExclude))
-				!= static_cast< AbstractPermutation::value_type >(currentExclude)) {
-				// This permutation is acting on an excluded position -> this won't be part of the resulting symmetry
-				include = false;
-				break;
-			}
-		}
-
-		if (include) {
-			if (excludedIndices.empty()) {
-				generators.push_back(currentPerm);
-			} else {
-				Permutation copy = currentPerm;
-
-				// Account for removed elements
-				for (std::size_t offset : excludedIndices) {
-					if (offset > copy->maxElement()) {
-						break;
-					}
-
-					copy->shift(-1, offset);
-				}
-
-				generators.push_back(std::move(copy));
+	if constexpr (std::is_same_v< PermGroup, DirectProductGroup >) {
+		std::vector< std::size_t > lhsExcludedIndices(lhsExcludes.begin(), lhsExcludes.end());
+		std::vector< std::size_t > rhsExcludedIndices(rhsExcludes.begin(), rhsExcludes.end());
+		std::sort(lhsExcludedIndices.begin(), lhsExcludedIndices.end());
+		std::sort(rhsExcludedIndices.begin(), rhsExcludedIndices.end());
+
+		DirectProductGroup product;
+		product.append(lhs, 0, lhsExcludedIndices);
+		product.append(rhs, static_cast< AbstractPermutation::value_type >(lhsSize), rhsExcludedIndices);
+
+		return product;
+	} else {
+		if constexpr (std::is_same_v< PermGroup, PrimitivePermutationGroup >) {
+			auto isFixedPointOfGroup = [](const AbstractPermutationGroup &group, auto point) {
+				const auto fixedPoint = static_cast< AbstractPermutation::value_type >(point);
+
+				return std::all_of(group.getGenerators().begin(), group.getGenerators().end(),
+								   [fixedPoint](const Permutation &currentGenerator) {
+									   return currentGenerator->image(fixedPoint) == fixedPoint;
+								   });
+			};
+
+			if (lhs.type() == PermutationGroupType::Primitive && rhs.type() == PermutationGroupType::Primitive
+				&& std::all_of(lhsExcludes.begin(), lhsExcludes.end(),
+							   [&](auto point) { return isFixedPointOfGroup(lhs, point); })
+				&& std::all_of(rhsExcludes.begin(), rhsExcludes.end(),
+							   [&](auto point) { return isFixedPointOfGroup(rhs, point); })) {
+				// No symmetry is lost due to the excluded points, so the concatenated group is the direct product of the
+				// (relabelled) input groups, whose elements can be obtained without running Dimino's algorithm
+				PrimitivePermutationGroup lhsGroup = static_cast< const PrimitivePermutationGroup & >(lhs);
+				PrimitivePermutationGroup rhsGroup = static_cast< const PrimitivePermutationGroup & >(rhs);
+
+				lhsGroup.removeFixedPoints(
+					std::vector< AbstractPermutation::value_type >(lhsExcludes.begin(), lhsExcludes.end()));
+				rhsGroup.removeFixedPoints(
+					std::vector< AbstractPermutation::value_type >(rhsExcludes.begin(), rhsExcludes.end()));
+				rhsGroup.shift(static_cast< int >(lhsSize));
+
+				return PrimitivePermutationGroup::directProduct(lhsGroup, rhsGroup);
 			}
 		}
-	}
 
+		std::vector< Permutation > generators = details::restrictGenerators(
+			lhs.getGenerators(), std::vector< std::size_t >(lhsExcludes.begin(), lhsExcludes.end()));
 
-	// Fetch and adapt generators from rhs
-	excludedIndices = std::vector< std::size_t >(rhsExcludes.begin(), rhsExcludes.end());
-	std::sort(excludedIndices.begin(), excludedIndices.end());
-
-	for (const Permutation &currentPerm : rhs.getGenerators()) {
-		if (currentPerm->isIdentity()) {
-			continue;
-		}
-
-		bool include = true;
+		for (Permutation &currentPerm : details::restrictGenerators(
+				 rhs.getGenerators(), std::vector< std::size_t >(rhsExcludes.begin(), rhsExcludes.end()))) {
+			// Account for the fact that the lhs sequence comes before the rhs one
+			currentPerm->shift(static_cast< int >(lhsSize));
 
-		for (auto currentExclude : excludedIndices) {
-			if (currentPerm->image(static_cast< AbstractPermutation::value_type >(currentExclude))
-				!= static_cast< AbstractPermutation::value_type >(currentExclude)) {
-				// This permutation is acting on an excluded position -> this won't be part of the resulting symmetry
-				include = false;
-				break;
-			}
+			generators.push_back(std::move(currentPerm));
 		}
 
-		if (include) {
-			perm::Permutation copy = currentPerm;
-
-			// Account for removed elements
-			for (std::size_t offset : excludedIndices) {
-				if (offset > copy->maxElement()) {
-					break;
-				}
-				copy->shift(-1, offset);
-			}
-
-			// Also account for the fact that the lhs sequence comes before the rhs one
-			copy->shift(static_cast< int >(lhsSize));
-
-			generators.push_back(std::move(copy));
-		}
+		return PermGroup(generators);
 	}
-
-	return PermGroup(generators);
 }
 
 
@@ -0,0 +1,127 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_YOUNGSUBGROUP_HPP_
+#define LIBPERM_YOUNGSUBGROUP_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/AbstractPermutationGroup.hpp"
+#include "libperm/Permutation.hpp"
+
+#include <cstddef>
+#include <iosfwd>
+#include <utility>
+#include <vector>
+
+namespace perm {
+
+/**
+ * A Young subgroup is the direct product of the symmetric groups over the blocks of a partition of the set of points
+ * the group acts on. Each block may additionally be declared antisymmetric, in which case odd permutations of that
+ * block's points carry a negative sign.
+ *
+ * Instead of explicitly storing the group's elements, this class only stores the partition. Therefore, the order of
+ * the group is obtained as a product of factorials, membership tests take linear time and canonical coset
+ * representatives are obtained by sorting the points within each block (O(n log n)).
+ *
+ * Note: Only generators that keep the group a Young subgroup can be used with this class. These are transpositions
+ * (with a sign of -1 for antisymmetric blocks and +1 for symmetric ones) and elements that are already contained
+ * in the group. Other generators are rejected with an exception.
+ */
+class YoungSubgroup : public AbstractPermutationGroup {
+public:
+	/**
+	 * A range of points {from, to} where from <= to and both from and to are understood to be inclusive
+	 */
+	using Range = std::pair< AbstractPermutation::value_type, AbstractPermutation::value_type >;
+
+	YoungSubgroup();
+	YoungSubgroup(std::vector< Permutation > generators);
+	/**
+	 * Constructs the Young subgroup that consists of all permutations of the points within each of the given ranges
+	 *
+	 * @param ranges The list of (non-overlapping) ranges
+	 * @param antisymmetric Whether odd permutations of the points within a range shall carry a negative sign
+	 */
+	YoungSubgroup(const std::vector< Range > &ranges, bool antisymmetric = false);
+
+	YoungSubgroup(const YoungSubgroup &) = default;
+	YoungSubgroup(YoungSubgroup &&)      = default;
+
+	YoungSubgroup &operator=(const YoungSubgroup &) = default;
+	YoungSubgroup &operator=(YoungSubgroup &&) = default;
+
+
+	virtual std::vector< AbstractPermutation::value_type >
+		orbit(AbstractPermutation::value_type point) const override final;
+
+	/**
+	 * @throws std::overflow_error if the order can't be represented as a std::size_t (e.g. for a block of more than 20
+	 * points). The same applies to rank and unrank.
+	 */
+	virtual std::size_t order() const override final;
+
+	virtual bool contains(const AbstractPermutation &perm) const override final;
+
+	/**
+	 * @throws std::invalid_argument if the given generator is neither contained in this group nor a transposition whose
+	 * sign matches the symmetry of the blocks it acts on
+	 */
+	virtual bool addGenerator(Permutation perm) override final;
+
+	/**
+	 * @throws std::invalid_argument if any of the given generators can't be used with this class. In that case, the
+	 * group remains unchanged.
+	 */
+	virtual void setGenerators(std::vector< Permutation > generators) override final;
+
+	virtual const std::vector< Permutation > &getGenerators() const override final;
+
+	virtual void getElementsTo(std::vector< Permutation > &permutations) const override final;
+
+	virtual std::size_t rank(const AbstractPermutation &perm) const override final;
+
+	virtual Permutation unrank(std::size_t rank) const override final;
+
+	virtual std::vector< Permutation > leftCoset(const AbstractPermutation &perm) const override final;
+
+	virtual std::vector< Permutation > rightCoset(const AbstractPermutation &perm) const override final;
+
+	virtual Permutation leftCosetRepresentative(const AbstractPermutation &perm) const override;
+
+	virtual Permutation rightCosetRepresentative(const AbstractPermutation &perm) const override;
+
+	friend std::ostream &operator<<(std::ostream &stream, const YoungSubgroup &group);
+
+protected:
+	struct Block {
+		/**
+		 * The points of this block in ascending order
+		 */
+		std::vector< AbstractPermutation::value_type > points;
+		bool antisymmetric = false;
+	};
+
+	static constexpr const std::size_t noBlock = static_cast< std::size_t >(-1);
+
+	std::vector< Block > m_blocks;
+	/**
+	 * Maps every point to the index of the block it belongs to (or noBlock, if it is only fixed by this group)
+	 */
+	std::vector< std::size_t > m_blockIndices;
+	std::vector< Permutation > m_generators;
+
+	std::size_t blockIndex(AbstractPermutation::value_type point) const;
+
+	void mergeBlocks(AbstractPermutation::value_type first, AbstractPermutation::value_type second,
+					 bool antisymmetric);
+
+	void updateBlockIndices();
+	void updateGenerators();
+};
+
+} // namespace perm
+
+#endif // LIBPERM_YOUNGSUBGROUP_HPP_
@@ -0,0 +1,45 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_DETAILS_CHECKEDARITHMETIC_HPP_
+#define LIBPERM_DETAILS_CHECKEDARITHMETIC_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+namespace perm::details {
+
+/**
+ * @returns The product of the given group orders
+ *
+ * @throws std::overflow_error if the product can't be represented as a std::size_t
+ */
+inline std::size_t checkedOrderProduct(std::size_t lhs, std::size_t rhs) {
+	if (lhs != 0 && rhs > std::numeric_limits< std::size_t >::max() / lhs) {
+		throw std::overflow_error("The order of the group exceeds the range of std::size_t");
+	}
+
+	return lhs * rhs;
+}
+
+/**
+ * @returns n! (the order of the symmetric group over n points)
+ *
+ * @throws std::overflow_error if the result can't be represented as a std::size_t
+ */
+inline std::size_t checkedFactorial(std::size_t n) {
+	std::size_t factorial = 1;
+
+	for (std::size_t i = 2; i <= n; ++i) {
+		factorial = checkedOrderProduct(factorial, i);
+	}
+
+	return factorial;
+}
+
+} // namespace perm::details
+
+#endif // LIBPERM_DETAILS_CHECKEDARITHMETIC_HPP_
@@ -0,0 +1,28 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_DETAILS_GENERATORRESTRICTION_HPP_
+#define LIBPERM_DETAILS_GENERATORRESTRICTION_HPP_
+
+#include "libperm/Permutation.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace perm::details {
+
+/**
+ * @returns The (non-identity) generators among the given ones that don't act on any of the excluded points. The
+ * remaining points are moved down to account for the removed points.
+ *
+ * @param generators The generators to restrict
+ * @param excludes The points to remove (in any order)
+ */
+std::vector< Permutation > restrictGenerators(const std::vector< Permutation > &generators,
+											  std::vector< std::size_t > excludes);
+
+} // namespace perm::details
+
+#endif // LIBPERM_DETAILS_GENERATORRESTRICTION_HPP_
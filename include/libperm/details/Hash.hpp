@@ -0,0 +1,58 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_DETAILS_HASH_HPP_
+#define LIBPERM_DETAILS_HASH_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace perm::details {
+
+/**
+ * @returns A hash of the given image points. The points are distributed over several independent hash lanes that are
+ * only combined at the very end, which allows the compiler to process multiple points at once using SIMD instructions.
+ */
+inline std::size_t hashImage(const AbstractPermutation::value_type *image, std::size_t size) {
+	constexpr std::size_t laneCount    = 4;
+	constexpr std::uint64_t multiplier = 0x100000001b3;
+
+	std::uint64_t lanes[laneCount] = { 0xcbf29ce484222325, 0x84222325cbf29ce4, 0x9e3779b97f4a7c15,
+									   0x7f4a7c159e3779b9 };
+
+	std::size_t i = 0;
+	for (; i + laneCount <= size; i += laneCount) {
+		for (std::size_t lane = 0; lane < laneCount; ++lane) {
+			lanes[lane] = (lanes[lane] ^ image[i + lane]) * multiplier;
+		}
+	}
+	for (; i < size; ++i) {
+		lanes[i % laneCount] = (lanes[i % laneCount] ^ image[i]) * multiplier;
+	}
+
+	// Combine the lanes using the finalizer of splitmix64
+	std::uint64_t hash = size;
+	for (std::uint64_t currentLane : lanes) {
+		hash ^= currentLane;
+		hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+		hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+		hash ^= hash >> 31;
+	}
+
+	return static_cast< std::size_t >(hash);
+}
+
+/**
+ * @returns The hash of a permutation with the given image hash and the given sign
+ */
+inline std::size_t hashWithSign(std::size_t imageHash, int sign) {
+	return sign < 0 ? ~imageHash : imageHash;
+}
+
+} // namespace perm::details
+
+#endif // LIBPERM_DETAILS_HASH_HPP_
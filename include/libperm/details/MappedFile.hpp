@@ -0,0 +1,63 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_DETAILS_MAPPEDFILE_HPP_
+#define LIBPERM_DETAILS_MAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <string>
+
+namespace perm::details {
+
+/**
+ * A read-only memory mapping of an entire file
+ */
+class MappedFile {
+public:
+	MappedFile() = default;
+	/**
+	 * Maps the file at the given path into memory. Use isOpen() to check whether this has succeeded.
+	 */
+	explicit MappedFile(const std::string &path);
+	~MappedFile();
+
+	MappedFile(const MappedFile &) = delete;
+	MappedFile(MappedFile &&other);
+
+	MappedFile &operator=(const MappedFile &) = delete;
+	MappedFile &operator=(MappedFile &&other);
+
+	/**
+	 * @returns Whether this object currently holds a valid mapping
+	 */
+	bool isOpen() const;
+
+	/**
+	 * @returns A pointer to the start of the mapped memory
+	 */
+	const unsigned char *data() const;
+
+	/**
+	 * @returns The size of the mapped memory in bytes
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Releases the mapping (if any)
+	 */
+	void close();
+
+protected:
+	const unsigned char *m_data = nullptr;
+	std::size_t m_size          = 0;
+#ifdef _WIN32
+	void *m_fileHandle    = nullptr;
+	void *m_mappingHandle = nullptr;
+#endif
+};
+
+} // namespace perm::details
+
+#endif // LIBPERM_DETAILS_MAPPEDFILE_HPP_
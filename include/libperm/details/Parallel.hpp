@@ -0,0 +1,77 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_DETAILS_PARALLEL_HPP_
+#define LIBPERM_DETAILS_PARALLEL_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace perm::details {
+
+/**
+ * The minimum amount of loop iterations that a single thread has to process in order for spawning it to be worth it
+ */
+constexpr std::size_t minIterationsPerThread = 2048;
+
+/**
+ * @returns The amount of threads to use, if the given amount of threads was requested. 0 is interpreted as "as many
+ * as there are hardware threads".
+ */
+inline std::size_t effectiveThreadCount(std::size_t requestedThreads) {
+	if (requestedThreads == 0) {
+		requestedThreads = std::thread::hardware_concurrency();
+	}
+
+	return std::max< std::size_t >(requestedThreads, 1);
+}
+
+/**
+ * Invokes the given function for contiguous, disjoint chunks of the range [begin, end) that together cover the entire
+ * range. The chunks are processed by up to the given amount of threads concurrently (where the calling thread is one
+ * of them). Ranges that are too small to benefit from parallelization are processed on the calling thread only.
+ *
+ * @param begin The start of the range
+ * @param end The (exclusive) end of the range
+ * @param threadCount The maximum amount of threads to use (0 means as many as there are hardware threads)
+ * @param func A callable taking the start and the (exclusive) end of the chunk that it shall process
+ */
+template< typename Func > void parallelFor(std::size_t begin, std::size_t end, std::size_t threadCount, Func &&func) {
+	if (begin >= end) {
+		return;
+	}
+
+	const std::size_t size = end - begin;
+	threadCount            = std::min(effectiveThreadCount(threadCount), size / minIterationsPerThread + 1);
+
+	if (threadCount == 1) {
+		func(begin, end);
+		return;
+	}
+
+	const std::size_t chunkSize = (size + threadCount - 1) / threadCount;
+
+	std::vector< std::thread > workers;
+	workers.reserve(threadCount - 1);
+
+	for (std::size_t t = 1; t < threadCount; ++t) {
+		const std::size_t chunkBegin = std::min(begin + t * chunkSize, end);
+		const std::size_t chunkEnd   = std::min(chunkBegin + chunkSize, end);
+
+		workers.emplace_back([&func, chunkBegin, chunkEnd]() { func(chunkBegin, chunkEnd); });
+	}
+
+	func(begin, std::min(begin + chunkSize, end));
+
+	for (std::thread &currentWorker : workers) {
+		currentWorker.join();
+	}
+}
+
+} // namespace perm::details
+
+#endif // LIBPERM_DETAILS_PARALLEL_HPP_
@@ -0,0 +1,89 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_DETAILS_RINGGROUP_HPP_
+#define LIBPERM_DETAILS_RINGGROUP_HPP_
+
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/AbstractPermutationGroup.hpp"
+#include "libperm/Permutation.hpp"
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace perm::details {
+
+/**
+ * Common implementation of groups describing the symmetries of n points arranged on a ring, that is the points
+ * 0, 1, ..., n-1 where n-1 is considered to be adjacent to 0 again. The group always contains all rotations of the
+ * ring and, if requested, all reflections of it as well.
+ *
+ * These groups are fully determined by the amount of points they act on and thus, their elements are never stored
+ * explicitly. Canonical coset representatives are computed analytically in O(n): as the images of a permutation are
+ * distinct, the least rotation of their sequence starts at the smallest image, which is found by a linear scan.
+ *
+ * Note: Generators can't be changed after construction. Only elements that are already contained in the group are
+ * accepted by addGenerator and setGenerators, which throw std::invalid_argument for any other permutation.
+ */
+class RingGroup : public AbstractPermutationGroup {
+public:
+	RingGroup(PermutationGroupType type, AbstractPermutation::value_type n, bool reflections);
+
+	/**
+	 * @returns The amount of points on the ring
+	 */
+	AbstractPermutation::value_type ringSize() const;
+
+	virtual std::vector< AbstractPermutation::value_type >
+		orbit(AbstractPermutation::value_type point) const override final;
+
+	virtual std::size_t order() const override final;
+
+	virtual bool contains(const AbstractPermutation &perm) const override final;
+
+	virtual bool addGenerator(Permutation perm) override final;
+
+	virtual void setGenerators(std::vector< Permutation > generators) override final;
+
+	virtual const std::vector< Permutation > &getGenerators() const override final;
+
+	virtual void getElementsTo(std::vector< Permutation > &permutations) const override final;
+
+	virtual std::size_t rank(const AbstractPermutation &perm) const override final;
+
+	virtual Permutation unrank(std::size_t rank) const override final;
+
+	virtual std::vector< Permutation > leftCoset(const AbstractPermutation &perm) const override final;
+
+	virtual std::vector< Permutation > rightCoset(const AbstractPermutation &perm) const override final;
+
+	virtual Permutation leftCosetRepresentative(const AbstractPermutation &perm) const override;
+
+	virtual Permutation rightCosetRepresentative(const AbstractPermutation &perm) const override;
+
+	friend std::ostream &operator<<(std::ostream &stream, const RingGroup &group);
+
+protected:
+	AbstractPermutation::value_type m_n;
+	bool m_reflections;
+	std::vector< Permutation > m_generators;
+
+	/**
+	 * @returns Whether this group contains reflections that are distinct from its rotations
+	 */
+	bool hasDistinctReflections() const;
+
+	/**
+	 * @returns The image of the ring element that maps i to (offset + i) mod n or to (offset - i) mod n, if
+	 * reflect is true
+	 */
+	std::vector< AbstractPermutation::value_type > elementImage(AbstractPermutation::value_type offset,
+																bool reflect) const;
+};
+
+} // namespace perm::details
+
+#endif // LIBPERM_DETAILS_RINGGROUP_HPP_
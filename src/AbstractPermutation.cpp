@@ -5,11 +5,49 @@
 
 
 #include "AbstractPermutation.hpp"
+#include "libperm/details/Hash.hpp"
 
+#include <algorithm>
 #include <sstream>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define LIBPERM_COMPARE_SSE2
+#endif
+
 namespace perm {
 
+/**
+ * @returns The index of the first position in which the given arrays differ or size, if there is no such position
+ */
+static std::size_t firstMismatch(const AbstractPermutation::value_type *lhs, const AbstractPermutation::value_type *rhs,
+								 std::size_t size) {
+	std::size_t i = 0;
+
+#ifdef LIBPERM_COMPARE_SSE2
+	static_assert(sizeof(AbstractPermutation::value_type) == 4, "The SSE2 code path assumes 32-bit points");
+
+	// Skip over equal blocks of 4 points at once. The position of the mismatch within a block is then determined by
+	// the scalar loop below.
+	for (; i + 4 <= size; i += 4) {
+		const __m128i lhsBlock = _mm_loadu_si128(reinterpret_cast< const __m128i * >(lhs + i));
+		const __m128i rhsBlock = _mm_loadu_si128(reinterpret_cast< const __m128i * >(rhs + i));
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(lhsBlock, rhsBlock)) != 0xffff) {
+			break;
+		}
+	}
+#endif
+
+	for (; i < size; ++i) {
+		if (lhs[i] != rhs[i]) {
+			return i;
+		}
+	}
+
+	return size;
+}
+
 AbstractPermutation::value_type AbstractPermutation::operator[](value_type value) const {
 	return image(value);
 }
@@ -22,6 +60,59 @@ bool operator!=(const AbstractPermutation &lhs, const AbstractPermutation &rhs)
 	return !(lhs == rhs);
 }
 
+bool operator<(const AbstractPermutation &lhs, const AbstractPermutation &rhs) {
+	return compare(lhs, rhs) < 0;
+}
+
+bool operator>(const AbstractPermutation &lhs, const AbstractPermutation &rhs) {
+	return compare(lhs, rhs) > 0;
+}
+
+bool operator<=(const AbstractPermutation &lhs, const AbstractPermutation &rhs) {
+	return compare(lhs, rhs) <= 0;
+}
+
+bool operator>=(const AbstractPermutation &lhs, const AbstractPermutation &rhs) {
+	return compare(lhs, rhs) >= 0;
+}
+
+int compare(const AbstractPermutation &lhs, const AbstractPermutation &rhs) {
+	const AbstractPermutation::value_type lhsMax = lhs.maxElement();
+	const AbstractPermutation::value_type rhsMax = rhs.maxElement();
+
+	AbstractPermutation::value_type i = 0;
+
+	const AbstractPermutation::value_type *lhsImage = lhs.contiguousImage();
+	const AbstractPermutation::value_type *rhsImage = rhs.contiguousImage();
+
+	if (lhsImage && rhsImage) {
+		const std::size_t commonSize = static_cast< std::size_t >(std::min(lhsMax, rhsMax)) + 1;
+
+		i = static_cast< AbstractPermutation::value_type >(firstMismatch(lhsImage, rhsImage, commonSize));
+
+		if (i < commonSize) {
+			return lhsImage[i] < rhsImage[i] ? -1 : 1;
+		}
+	}
+
+	// Compare the remaining points (if any) one by one
+	const AbstractPermutation::value_type n = std::max(lhsMax, rhsMax);
+	for (; i <= n; ++i) {
+		const AbstractPermutation::value_type lhsPoint = lhs.image(i);
+		const AbstractPermutation::value_type rhsPoint = rhs.image(i);
+
+		if (lhsPoint != rhsPoint) {
+			return lhsPoint < rhsPoint ? -1 : 1;
+		}
+	}
+
+	if (lhs.sign() != rhs.sign()) {
+		return lhs.sign() < rhs.sign() ? -1 : 1;
+	}
+
+	return 0;
+}
+
 AbstractPermutation &operator*=(AbstractPermutation &lhs, const AbstractPermutation &rhs) {
 	lhs.postMultiply(rhs);
 
@@ -68,6 +159,24 @@ bool AbstractPermutation::equals(const AbstractPermutation &other) const {
 	return true;
 }
 
+std::size_t AbstractPermutation::hash() const {
+	value_type n = maxElement() + 1;
+	while (n > 0 && image(n - 1) == n - 1) {
+		--n;
+	}
+
+	std::vector< value_type > reducedImage(n);
+	for (value_type i = 0; i < n; ++i) {
+		reducedImage[i] = image(i);
+	}
+
+	return details::hashWithSign(details::hashImage(reducedImage.data(), reducedImage.size()), sign());
+}
+
+const AbstractPermutation::value_type *AbstractPermutation::contiguousImage() const {
+	return nullptr;
+}
+
 std::string AbstractPermutation::toString() const {
 	std::stringstream sstream;
 
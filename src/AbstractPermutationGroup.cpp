@@ -5,12 +5,90 @@
 
 #include "libperm/AbstractPermutationGroup.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <utility>
+
 namespace perm {
 
 Permutation AbstractPermutationGroup::getCanonicalCosetRepresentative(const AbstractPermutation &perm) const {
 	return rightCosetRepresentative(perm);
 }
 
+std::vector< std::vector< AbstractPermutation::value_type > > AbstractPermutationGroup::orbits() const {
+	const std::vector< Permutation > &generators = getGenerators();
+
+	AbstractPermutation::value_type degree = 0;
+	for (const Permutation &currentGenerator : generators) {
+		if (!currentGenerator->isIdentity()) {
+			degree = std::max(degree, currentGenerator->maxElement() + 1);
+		}
+	}
+
+	// Two points lie in the same orbit, if they are connected by the action of the generators. Therefore, the orbits
+	// are obtained by merging every point with its images in a union-find structure. The root of every set is its
+	// smallest point.
+	std::vector< AbstractPermutation::value_type > parents(degree);
+	std::iota(parents.begin(), parents.end(), 0);
+
+	const auto findRoot = [&parents](AbstractPermutation::value_type point) {
+		while (parents[point] != point) {
+			// Path halving
+			parents[point] = parents[parents[point]];
+			point          = parents[point];
+		}
+
+		return point;
+	};
+
+	for (const Permutation &currentGenerator : generators) {
+		for (AbstractPermutation::value_type i = 0; i < degree && i <= currentGenerator->maxElement(); ++i) {
+			const AbstractPermutation::value_type first  = findRoot(i);
+			const AbstractPermutation::value_type second = findRoot(currentGenerator->image(i));
+
+			if (first != second) {
+				parents[std::max(first, second)] = std::min(first, second);
+			}
+		}
+	}
+
+	std::vector< std::vector< AbstractPermutation::value_type > > orbits;
+	std::vector< std::size_t > orbitIndices(degree);
+
+	for (AbstractPermutation::value_type i = 0; i < degree; ++i) {
+		const AbstractPermutation::value_type root = findRoot(i);
+
+		if (root == i) {
+			orbitIndices[i] = orbits.size();
+			orbits.emplace_back();
+		}
+
+		orbits[orbitIndices[root]].push_back(i);
+	}
+
+	return orbits;
+}
+
+std::size_t AbstractPermutationGroup::rank(const AbstractPermutation &perm) const {
+	std::vector< Permutation > elements;
+	getElementsTo(elements);
+
+	const auto it = std::find_if(elements.begin(), elements.end(),
+								 [&perm](const Permutation &current) { return current.get() == perm; });
+
+	return static_cast< std::size_t >(it - elements.begin());
+}
+
+Permutation AbstractPermutationGroup::unrank(std::size_t rank) const {
+	std::vector< Permutation > elements;
+	getElementsTo(elements);
+
+	assert(rank < elements.size());
+
+	return std::move(elements[rank]);
+}
+
 bool operator==(const AbstractPermutationGroup &lhs, const AbstractPermutationGroup &rhs) {
 	if (lhs.order() != rhs.order()) {
 		return false;
@@ -10,35 +10,72 @@
 
 namespace perm {
 
-Cycle::Cycle(std::vector< Cycle::value_type > cycle) {
-	m_cycles.push_back(std::move(cycle));
+Cycle::Cycle(const allocator_type &alloc) : m_values(alloc), m_offsets(1, 0, alloc) {
 }
 
-Cycle::Cycle(std::vector< std::vector< Cycle::value_type > > cycles) : m_cycles(std::move(cycles)) {
+Cycle::Cycle(const std::vector< Cycle::value_type > &cycle, const allocator_type &alloc)
+	: m_values(cycle.begin(), cycle.end(), alloc), m_offsets(alloc) {
+	m_offsets.reserve(2);
+	m_offsets.push_back(0);
+	m_offsets.push_back(m_values.size());
+}
+
+Cycle::Cycle(const std::vector< std::vector< Cycle::value_type > > &cycles, const allocator_type &alloc)
+	: Cycle(alloc) {
+	std::size_t totalSize = 0;
+	for (const std::vector< Cycle::value_type > &currentCycle : cycles) {
+		totalSize += currentCycle.size();
+	}
+
+	m_values.reserve(totalSize);
+	m_offsets.reserve(cycles.size() + 1);
+
+	for (const std::vector< Cycle::value_type > &currentCycle : cycles) {
+		m_values.insert(m_values.end(), currentCycle.begin(), currentCycle.end());
+		m_offsets.push_back(m_values.size());
+	}
+}
+
+Cycle::Cycle(const Cycle &other, const allocator_type &alloc)
+	: m_values(other.m_values, alloc), m_offsets(other.m_offsets, alloc) {
+}
+
+Cycle::allocator_type Cycle::get_allocator() const {
+	return m_values.get_allocator();
 }
 
 Cycle::iterator Cycle::begin() {
-	return m_cycles.begin();
+	return cbegin();
 }
 
 Cycle::iterator Cycle::end() {
-	return m_cycles.end();
+	return cend();
 }
 
 Cycle::const_iterator Cycle::begin() const {
-	return m_cycles.begin();
+	return cbegin();
 }
 
 Cycle::const_iterator Cycle::end() const {
-	return m_cycles.end();
+	return cend();
 }
 
 Cycle::const_iterator Cycle::cbegin() const {
-	return m_cycles.cbegin();
+	return const_iterator(m_values.data(), m_offsets.data());
 }
 
 Cycle::const_iterator Cycle::cend() const {
-	return m_cycles.cend();
+	return const_iterator(m_values.data(), m_offsets.data() + m_offsets.size() - 1);
+}
+
+std::size_t Cycle::size() const {
+	return m_offsets.size() - 1;
+}
+
+Cycle::Span Cycle::operator[](std::size_t index) const {
+	assert(index < size());
+
+	return Span(m_values.data() + m_offsets[index], m_values.data() + m_offsets[index + 1]);
 }
 
 bool operator==(const Cycle &lhs, const Cycle &rhs) {
@@ -51,7 +88,7 @@ bool operator!=(const Cycle &lhs, const Cycle &rhs) {
 
 std::ostream &operator<<(std::ostream &stream, const Cycle &cycle) {
 	bool isIdentity = true;
-	for (const std::vector< Cycle::value_type > &currentCycle : cycle.m_cycles) {
+	for (const Cycle::Span currentCycle : cycle) {
 		if (currentCycle.size() == 1) {
 			continue;
 		}
@@ -73,19 +110,9 @@ std::ostream &operator<<(std::ostream &stream, const Cycle &cycle) {
 }
 
 Cycle::value_type Cycle::maxElement() const {
-	Cycle::value_type max = 0;
-
-	for (const std::vector< Cycle::value_type > &currentCycle : m_cycles) {
-		auto maxElement = std::max_element(currentCycle.begin(), currentCycle.end());
-
-		if (maxElement == currentCycle.end()) {
-			continue;
-		}
-
-		max = std::max(max, *maxElement);
-	}
+	auto maxElement = std::max_element(m_values.begin(), m_values.end());
 
-	return max;
+	return maxElement == m_values.end() ? 0 : *maxElement;
 }
 
 
@@ -4,43 +4,83 @@
 // <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
 
 #include "libperm/DiminoAlgorithm.hpp"
+#include "libperm/ExplicitPermutation.hpp"
 #include "libperm/Permutation.hpp"
+#include "libperm/details/Parallel.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <vector>
 
 namespace perm::DiminoAlgorithm {
 
-std::vector< Permutation > generateGroupElements(const std::vector< Permutation > &S) {
+/**
+ * Appends the coset H x rep to H, where H are the first cosetSize elements of the given list. The coset's elements
+ * are computed concurrently (if requested), but they are always stored in the same order. Their images are allocated
+ * from the given memory resource.
+ */
+static void appendCoset(std::vector< Permutation > &H, std::size_t cosetSize, const AbstractPermutation &rep,
+						std::size_t threadCount, pmr::memory_resource *resource) {
+	const std::size_t cosetStart = H.size();
+
+	if (details::effectiveThreadCount(threadCount) == 1) {
+		for (std::size_t m = 0; m < cosetSize; ++m) {
+			ExplicitPermutation h(H[m].get(), resource);
+			h.postMultiply(rep);
+			H.push_back(std::move(h));
+		}
+
+		return;
+	}
+
+	// Preallocate the storage for the entire coset, so that the individual threads can write to it independently
+	for (std::size_t m = 0; m < cosetSize; ++m) {
+		H.emplace_back(ExplicitPermutation(resource));
+	}
+
+	details::parallelFor(0, cosetSize, threadCount, [&](std::size_t begin, std::size_t end) {
+		for (std::size_t m = begin; m < end; ++m) {
+			composeInto(static_cast< ExplicitPermutation & >(H[cosetStart + m].get()), H[m].get(), rep);
+		}
+	});
+}
+
+std::vector< Permutation > generateGroupElements(const std::vector< Permutation > &S, std::size_t threadCount,
+												 pmr::memory_resource *resource) {
 	std::vector< Permutation > G;
 
 	if (S.empty()) {
 		return G;
 	}
 
-	// Start creating the first sub-group of G = < S > by adding all powers of the
-	// first generator s. Since we expect to deal with finite groups, the series
-	// g = s, s^2, s^3, ... will eventually produce the identity permutation, at which
-	// point we have generated all elements of H = < s >.
-	// We notice this, when the next power of s is equal to s again.
+	// Start creating the first sub-group of G = < S > by adding all powers s, s^2, ..., s^k = id of the first
+	// generator s. The order k of s is known from its cycle structure and every power can be computed directly from it,
+	// so the cyclic subgroup can be filled in without any sequential dependency between its elements.
 	const Permutation &s = S[0];
-	Permutation g        = s;
 
-	do {
-		G.push_back(g);
+	const std::size_t cyclicOrder = order(s.get());
+	G.reserve(cyclicOrder);
+	for (std::size_t m = 0; m < cyclicOrder; ++m) {
+		G.emplace_back(ExplicitPermutation(resource));
+	}
 
-		g *= s;
-	} while (g != s);
+	details::parallelFor(0, G.size(), threadCount, [&](std::size_t begin, std::size_t end) {
+		for (std::size_t m = begin; m < end; ++m) {
+			static_cast< ExplicitPermutation & >(G[m].get()) =
+				power(s.get(), static_cast< std::int64_t >(m + 1), resource);
+		}
+	});
 
 	for (std::size_t i = 1; i < S.size(); ++i) {
-		extendGroup(G, S, i);
+		extendGroup(G, S, i, threadCount, resource);
 	}
 
 	return G;
 }
 
-bool extendGroup(std::vector< Permutation > &H, const std::vector< Permutation > &S, std::size_t i) {
+bool extendGroup(std::vector< Permutation > &H, const std::vector< Permutation > &S, std::size_t i,
+				 std::size_t threadCount, pmr::memory_resource *resource) {
 	assert(!H.empty());
 	// This function can only be used, if the group has been pre-constructed from at least one generator
 	assert(i > 0);
@@ -65,11 +105,7 @@ bool extendGroup(std::vector< Permutation > &H, const std::vector< Permutation >
 	// at once, without the need to check whether the individual elements might
 	// be contained in H already.
 	H.reserve(H.size() + cosetSize);
-	for (std::size_t k = 0; k < cosetSize; ++k) {
-		Permutation hs = H[k];
-		hs *= s;
-		H.push_back(std::move(hs));
-	}
+	appendCoset(H, cosetSize, s.get(), threadCount, resource);
 
 	std::size_t cosetRepresentativePos = cosetSize;
 
@@ -86,18 +122,15 @@ bool extendGroup(std::vector< Permutation > &H, const std::vector< Permutation >
 		for (std::size_t k = 0; k <= i; ++k) {
 			const Permutation &s_i = S[k];
 
-			Permutation rep = H[cosetRepresentativePos];
-			rep *= s_i;
+			ExplicitPermutation rep(H[cosetRepresentativePos].get(), resource);
+			rep.postMultiply(s_i.get());
 
 			if (std::find(H.begin(), H.end(), rep) == H.end()) {
 				// The found coset representative is not yet contained in the group -> add entire coset
+				// Note: The representatives are discovered sequentially, which makes the order of the generated
+				// elements independent of the amount of threads used to fill in the cosets.
 				H.reserve(H.size() + cosetSize);
-
-				for (std::size_t m = 0; m < cosetSize; ++m) {
-					Permutation h = H[m];
-					h *= rep;
-					H.push_back(std::move(h));
-				}
+				appendCoset(H, cosetSize, rep, threadCount, resource);
 			}
 		}
 
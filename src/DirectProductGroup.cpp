@@ -0,0 +1,637 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/DirectProductGroup.hpp"
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/ExplicitPermutation.hpp"
+#include "libperm/PrimitivePermutationGroup.hpp"
+#include "libperm/details/CheckedArithmetic.hpp"
+#include "libperm/details/GeneratorRestriction.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <utility>
+
+namespace perm {
+
+/**
+ * @returns A copy of the given permutation in which all points are moved by the given amount. If points are moved
+ * down, the permutation must not act on any of the points that would become negative.
+ */
+static Permutation shiftedPermutation(const AbstractPermutation &perm, int amount) {
+	ExplicitPermutation::image_type image;
+	image.reserve(perm.maxElement() + 1);
+
+	for (AbstractPermutation::value_type i = 0; i <= perm.maxElement(); ++i) {
+		const int point = static_cast< int >(i) + amount;
+
+		if (point < 0) {
+			assert(perm.image(i) == i);
+			continue;
+		}
+
+		while (image.size() < static_cast< std::size_t >(point)) {
+			image.push_back(static_cast< AbstractPermutation::value_type >(image.size()));
+		}
+
+		image.push_back(static_cast< AbstractPermutation::value_type >(static_cast< int >(perm.image(i)) + amount));
+	}
+
+	return ExplicitPermutation(std::move(image), perm.sign());
+}
+
+/**
+ * Partitions the given generators into sets acting on disjoint, contiguous blocks of points and creates one factor
+ * per block.
+ */
+static std::vector< DirectProductGroup::Factor > decomposeGenerators(std::vector< Permutation > generators) {
+	struct Block {
+		AbstractPermutation::value_type first;
+		AbstractPermutation::value_type last;
+		std::vector< Permutation > generators;
+	};
+
+	std::vector< Block > blocks;
+
+	for (Permutation &currentGenerator : generators) {
+		if (currentGenerator->isIdentity()) {
+			continue;
+		}
+
+		Block block{ currentGenerator->maxElement(), 0, {} };
+		for (AbstractPermutation::value_type i = 0; i <= currentGenerator->maxElement(); ++i) {
+			if (currentGenerator->image(i) != i) {
+				block.first = std::min(block.first, i);
+				block.last  = std::max(block.last, i);
+			}
+		}
+		block.generators.push_back(std::move(currentGenerator));
+
+		blocks.push_back(std::move(block));
+	}
+
+	std::sort(blocks.begin(), blocks.end(), [](const Block &lhs, const Block &rhs) { return lhs.first < rhs.first; });
+
+	// Merge overlapping blocks
+	std::vector< Block > mergedBlocks;
+	for (Block &currentBlock : blocks) {
+		if (!mergedBlocks.empty() && mergedBlocks.back().last >= currentBlock.first) {
+			Block &previous = mergedBlocks.back();
+
+			previous.last = std::max(previous.last, currentBlock.last);
+			std::move(currentBlock.generators.begin(), currentBlock.generators.end(),
+					  std::back_inserter(previous.generators));
+		} else {
+			mergedBlocks.push_back(std::move(currentBlock));
+		}
+	}
+
+	std::vector< DirectProductGroup::Factor > factors;
+	factors.reserve(mergedBlocks.size());
+
+	for (Block &currentBlock : mergedBlocks) {
+		for (Permutation &currentGenerator : currentBlock.generators) {
+			currentGenerator = shiftedPermutation(currentGenerator.get(), -static_cast< int >(currentBlock.first));
+		}
+
+		factors.push_back({ PrimitivePermutationGroup(std::move(currentBlock.generators)), currentBlock.first,
+							currentBlock.last - currentBlock.first + 1 });
+	}
+
+	return factors;
+}
+
+DirectProductGroup::DirectProductGroup() : AbstractPermutationGroup(PermutationGroupType::DirectProduct) {
+	updateGenerators();
+}
+
+DirectProductGroup::DirectProductGroup(std::vector< Permutation > generators)
+	: AbstractPermutationGroup(PermutationGroupType::DirectProduct) {
+	setGenerators(std::move(generators));
+}
+
+DirectProductGroup::DirectProductGroup(std::vector< Factor > factors)
+	: AbstractPermutationGroup(PermutationGroupType::DirectProduct) {
+	for (Factor &currentFactor : factors) {
+		addFactor(std::move(currentFactor));
+	}
+
+	mergeSignedFactors();
+	updateGenerators();
+}
+
+void DirectProductGroup::append(const AbstractPermutationGroup &group, AbstractPermutation::value_type offset,
+								const std::vector< std::size_t > &excludes) {
+	assert(std::is_sorted(excludes.begin(), excludes.end()));
+
+	if (group.type() == PermutationGroupType::DirectProduct) {
+		// Flatten nested products by appending their factors individually
+		const DirectProductGroup &product = static_cast< const DirectProductGroup & >(group);
+
+		for (const Factor &currentFactor : product.m_factors) {
+			const auto blockBegin = std::lower_bound(excludes.begin(), excludes.end(), currentFactor.offset);
+			const auto blockEnd =
+				std::lower_bound(blockBegin, excludes.end(), currentFactor.offset + currentFactor.size);
+
+			std::vector< std::size_t > localExcludes(blockBegin, blockEnd);
+			for (std::size_t &currentExclude : localExcludes) {
+				currentExclude -= currentFactor.offset;
+			}
+
+			const auto removedBefore = static_cast< AbstractPermutation::value_type >(blockBegin - excludes.begin());
+
+			append(currentFactor.group.get(), offset + currentFactor.offset - removedBefore, localExcludes);
+		}
+
+		return;
+	}
+
+	if (group.order() == 1) {
+		// Trivial factors don't contribute anything
+		return;
+	}
+
+	const std::vector< Permutation > &generators = group.getGenerators();
+	const bool affectedByExcludes =
+		std::any_of(excludes.begin(), excludes.end(), [&](std::size_t currentExclude) {
+			return std::any_of(generators.begin(), generators.end(), [&](const Permutation &currentGenerator) {
+				return currentExclude <= currentGenerator->maxElement();
+			});
+		});
+
+	if (!affectedByExcludes) {
+		AbstractPermutation::value_type size = 0;
+		for (const Permutation &currentGenerator : generators) {
+			size = std::max(size, currentGenerator->maxElement() + 1);
+		}
+
+		addFactor({ toPermutationGroup(group), offset, size });
+	} else {
+		for (Factor &currentFactor : decomposeGenerators(details::restrictGenerators(group.getGenerators(), excludes))) {
+			currentFactor.offset += offset;
+			addFactor(std::move(currentFactor));
+		}
+	}
+
+	mergeSignedFactors();
+	updateGenerators();
+}
+
+const std::vector< DirectProductGroup::Factor > &DirectProductGroup::getFactors() const {
+	return m_factors;
+}
+
+std::vector< AbstractPermutation::value_type >
+	DirectProductGroup::orbit(AbstractPermutation::value_type point) const {
+	const std::size_t index = factorIndex(point);
+
+	if (index == m_factors.size()) {
+		return { point };
+	}
+
+	const Factor &factor = m_factors[index];
+
+	std::vector< AbstractPermutation::value_type > orbit = factor.group->orbit(point - factor.offset);
+	for (AbstractPermutation::value_type &currentPoint : orbit) {
+		currentPoint += factor.offset;
+	}
+
+	// Start the orbit with the given point itself (the image under the identity element)
+	std::rotate(orbit.begin(), std::find(orbit.begin(), orbit.end(), point), orbit.end());
+
+	return orbit;
+}
+
+std::size_t DirectProductGroup::order() const {
+	std::size_t order = 1;
+
+	for (const Factor &currentFactor : m_factors) {
+		order = details::checkedOrderProduct(order, currentFactor.group->order());
+	}
+
+	return order;
+}
+
+bool DirectProductGroup::contains(const AbstractPermutation &perm) const {
+	// Every point has to stay within its block
+	for (AbstractPermutation::value_type i = 0; i <= perm.maxElement(); ++i) {
+		const std::size_t index = factorIndex(i);
+
+		if (index == m_factors.size() ? perm.image(i) != i : factorIndex(perm.image(i)) != index) {
+			return false;
+		}
+	}
+
+	// The action on every block has to be contained in the corresponding factor. As the sign is a global property, we
+	// have to keep track of which overall signs can be reached by the combination of the individual factors.
+	bool canBePositive = true;
+	bool canBeNegative = false;
+
+	std::vector< AbstractPermutation::value_type > localImage;
+	for (const Factor &currentFactor : m_factors) {
+		localImage.resize(currentFactor.size);
+		for (AbstractPermutation::value_type k = 0; k < currentFactor.size; ++k) {
+			localImage[k] = perm.image(currentFactor.offset + k) - currentFactor.offset;
+		}
+
+		ExplicitPermutation localPerm(localImage);
+		const bool positive = currentFactor.group->contains(localPerm);
+		localPerm.setSign(-1);
+		const bool negative = currentFactor.group->contains(localPerm);
+
+		const bool previousPositive = canBePositive;
+		canBePositive               = (canBePositive && positive) || (canBeNegative && negative);
+		canBeNegative               = (previousPositive && negative) || (canBeNegative && positive);
+
+		if (!canBePositive && !canBeNegative) {
+			return false;
+		}
+	}
+
+	return perm.sign() > 0 ? canBePositive : canBeNegative;
+}
+
+bool DirectProductGroup::addGenerator(Permutation perm) {
+	if (contains(perm.get())) {
+		return false;
+	}
+
+	AbstractPermutation::value_type first = perm->maxElement();
+	AbstractPermutation::value_type last  = 0;
+	for (AbstractPermutation::value_type i = 0; i <= perm->maxElement(); ++i) {
+		if (perm->image(i) != i) {
+			first = std::min(first, i);
+			last  = std::max(last, i);
+		}
+	}
+	first = std::min(first, last);
+
+	// All factors whose blocks overlap with the points acted on by the new generator have to be merged
+	std::vector< Permutation > generators = { std::move(perm) };
+	std::vector< Factor > remainingFactors;
+
+	for (Factor &currentFactor : m_factors) {
+		if (currentFactor.offset > last || currentFactor.offset + currentFactor.size <= first) {
+			remainingFactors.push_back(std::move(currentFactor));
+			continue;
+		}
+
+		first = std::min(first, currentFactor.offset);
+		last  = std::max(last, currentFactor.offset + currentFactor.size - 1);
+
+		for (const Permutation &currentGenerator : currentFactor.group->getGenerators()) {
+			generators.push_back(shiftedPermutation(currentGenerator.get(), static_cast< int >(currentFactor.offset)));
+		}
+	}
+
+	for (Permutation &currentGenerator : generators) {
+		currentGenerator = shiftedPermutation(currentGenerator.get(), -static_cast< int >(first));
+	}
+
+	m_factors = std::move(remainingFactors);
+	addFactor({ PrimitivePermutationGroup(std::move(generators)), first, last - first + 1 });
+
+	mergeSignedFactors();
+	updateGenerators();
+
+	return true;
+}
+
+void DirectProductGroup::setGenerators(std::vector< Permutation > generators) {
+	m_factors = decomposeGenerators(std::move(generators));
+
+	mergeSignedFactors();
+	updateGenerators();
+}
+
+const std::vector< Permutation > &DirectProductGroup::getGenerators() const {
+	return m_generators;
+}
+
+void DirectProductGroup::getElementsTo(std::vector< Permutation > &permutations) const {
+	permutations.clear();
+	permutations.reserve(order());
+
+	forEachElement([&](const ExplicitPermutation &element) { permutations.push_back(element); });
+}
+
+std::size_t DirectProductGroup::rank(const AbstractPermutation &perm) const {
+	// As all ranks are smaller than the group's order, the mixed-radix number below can't overflow, if this doesn't
+	const std::size_t groupOrder = order();
+
+	// Every point has to stay within its block
+	for (AbstractPermutation::value_type i = 0; i <= perm.maxElement(); ++i) {
+		const std::size_t index = factorIndex(i);
+
+		if (index == m_factors.size() ? perm.image(i) != i : factorIndex(perm.image(i)) != index) {
+			return groupOrder;
+		}
+	}
+
+	// The rank is a mixed-radix number whose i-th digit is the rank of the action on the i-th block within the i-th
+	// factor (with radix |factor|), just as in the enumeration order of forEachElement. As the sign is a global
+	// property, the signs of the factors' elements have to be chosen such that they multiply to the sign of perm.
+	std::vector< std::size_t > localRanks(m_factors.size());
+	std::vector< std::size_t > alternativeRanks(m_factors.size());
+	int sign = 1;
+
+	std::vector< AbstractPermutation::value_type > localImage;
+	for (std::size_t index = 0; index < m_factors.size(); ++index) {
+		const Factor &currentFactor   = m_factors[index];
+		const std::size_t factorOrder = currentFactor.group->order();
+
+		localImage.resize(currentFactor.size);
+		for (AbstractPermutation::value_type k = 0; k < currentFactor.size; ++k) {
+			localImage[k] = perm.image(currentFactor.offset + k) - currentFactor.offset;
+		}
+
+		ExplicitPermutation localPerm(localImage);
+		const std::size_t positiveRank = currentFactor.group->rank(localPerm);
+		localPerm.setSign(-1);
+		const std::size_t negativeRank = currentFactor.group->rank(localPerm);
+
+		if (positiveRank != factorOrder) {
+			localRanks[index]       = positiveRank;
+			alternativeRanks[index] = negativeRank;
+		} else if (negativeRank != factorOrder) {
+			localRanks[index]       = negativeRank;
+			alternativeRanks[index] = factorOrder;
+			sign                    = -sign;
+		} else {
+			return groupOrder;
+		}
+	}
+
+	if (sign != perm.sign()) {
+		// The sign can only be fixed by a factor that contains its local action with both signs
+		std::size_t index = 0;
+		while (index < m_factors.size() && alternativeRanks[index] == m_factors[index].group->order()) {
+			++index;
+		}
+
+		if (index == m_factors.size()) {
+			return groupOrder;
+		}
+
+		localRanks[index] = alternativeRanks[index];
+	}
+
+	std::size_t rank = 0;
+	for (std::size_t index = m_factors.size(); index-- > 0;) {
+		rank = rank * m_factors[index].group->order() + localRanks[index];
+	}
+
+	return rank;
+}
+
+Permutation DirectProductGroup::unrank(std::size_t rank) const {
+	assert(rank < order());
+
+	ExplicitPermutation::image_type image(pointCount());
+	std::iota(image.begin(), image.end(), 0);
+	int sign = 1;
+
+	for (const Factor &currentFactor : m_factors) {
+		const std::size_t factorOrder = currentFactor.group->order();
+
+		const Permutation localElement = currentFactor.group->unrank(rank % factorOrder);
+		rank /= factorOrder;
+
+		for (AbstractPermutation::value_type k = 0; k < currentFactor.size; ++k) {
+			image[currentFactor.offset + k] = currentFactor.offset + localElement->image(k);
+		}
+
+		sign *= localElement->sign();
+	}
+
+	return ExplicitPermutation(std::move(image), sign);
+}
+
+std::vector< Permutation > DirectProductGroup::leftCoset(const AbstractPermutation &perm) const {
+	std::vector< Permutation > coset;
+	coset.reserve(order());
+
+	forEachElement([&](const ExplicitPermutation &element) {
+		coset.push_back(element);
+		coset.back()->preMultiply(perm);
+	});
+
+	return coset;
+}
+
+std::vector< Permutation > DirectProductGroup::rightCoset(const AbstractPermutation &perm) const {
+	std::vector< Permutation > coset;
+	coset.reserve(order());
+
+	forEachElement([&](const ExplicitPermutation &element) {
+		coset.push_back(element);
+		coset.back()->postMultiply(perm);
+	});
+
+	return coset;
+}
+
+Permutation DirectProductGroup::leftCosetRepresentative(const AbstractPermutation &perm) const {
+	// The elements of the left coset are g * h where h = h_1 * h_2 * ... and h_i acts on the i-th block only. The
+	// image of i is h(g(i)). The positions i for which g(i) lies in a given block, are only affected by the factor
+	// acting on that block. Thus, every factor can be canonicalized independently by considering the local
+	// permutation that maps the j-th of these positions to g(i) (relative to the block's offset).
+	const AbstractPermutation::value_type n = std::max(perm.maxElement() + 1, pointCount());
+
+	ExplicitPermutation::image_type image(n);
+	std::vector< std::vector< AbstractPermutation::value_type > > positions(m_factors.size());
+
+	for (AbstractPermutation::value_type i = 0; i < n; ++i) {
+		const std::size_t index = factorIndex(perm.image(i));
+
+		if (index == m_factors.size()) {
+			image[i] = perm.image(i);
+		} else {
+			positions[index].push_back(i);
+		}
+	}
+
+	int sign = perm.sign();
+	std::vector< AbstractPermutation::value_type > localImage;
+
+	for (std::size_t index = 0; index < m_factors.size(); ++index) {
+		const Factor &currentFactor = m_factors[index];
+		assert(positions[index].size() == currentFactor.size);
+
+		localImage.resize(currentFactor.size);
+		for (AbstractPermutation::value_type k = 0; k < currentFactor.size; ++k) {
+			localImage[k] = perm.image(positions[index][k]) - currentFactor.offset;
+		}
+
+		const Permutation localRepresentative =
+			currentFactor.group->leftCosetRepresentative(ExplicitPermutation(localImage));
+
+		for (AbstractPermutation::value_type k = 0; k < currentFactor.size; ++k) {
+			image[positions[index][k]] = currentFactor.offset + localRepresentative->image(k);
+		}
+
+		sign *= localRepresentative->sign();
+	}
+
+	return ExplicitPermutation(std::move(image), sign);
+}
+
+Permutation DirectProductGroup::rightCosetRepresentative(const AbstractPermutation &perm) const {
+	// The elements of the right coset are h * g where h = h_1 * h_2 * ... and h_i acts on the i-th block only. The
+	// image of i is g(h(i)), so the images of the points in a block are only affected by the factor acting on that
+	// block. Since only the relative order of the images matters, every factor can be canonicalized independently by
+	// considering the local permutation that maps every point of the block to the rank of its image.
+	const AbstractPermutation::value_type n = std::max(perm.maxElement() + 1, pointCount());
+
+	ExplicitPermutation::image_type image(n);
+	for (AbstractPermutation::value_type i = 0; i < n; ++i) {
+		image[i] = perm.image(i);
+	}
+
+	int sign = perm.sign();
+	std::vector< AbstractPermutation::value_type > sortedImages;
+	std::vector< AbstractPermutation::value_type > localImage;
+
+	for (const Factor &currentFactor : m_factors) {
+		sortedImages.assign(image.begin() + currentFactor.offset,
+							image.begin() + currentFactor.offset + currentFactor.size);
+		std::sort(sortedImages.begin(), sortedImages.end());
+
+		localImage.resize(currentFactor.size);
+		for (AbstractPermutation::value_type k = 0; k < currentFactor.size; ++k) {
+			localImage[k] = static_cast< AbstractPermutation::value_type >(
+				std::lower_bound(sortedImages.begin(), sortedImages.end(), image[currentFactor.offset + k])
+				- sortedImages.begin());
+		}
+
+		const Permutation localRepresentative =
+			currentFactor.group->rightCosetRepresentative(ExplicitPermutation(localImage));
+
+		for (AbstractPermutation::value_type k = 0; k < currentFactor.size; ++k) {
+			image[currentFactor.offset + k] = sortedImages[localRepresentative->image(k)];
+		}
+
+		sign *= localRepresentative->sign();
+	}
+
+	return ExplicitPermutation(std::move(image), sign);
+}
+
+std::ostream &operator<<(std::ostream &stream, const DirectProductGroup &group) {
+	stream << "direct product of { ";
+	for (std::size_t i = 0; i < group.m_factors.size(); ++i) {
+		const DirectProductGroup::Factor &currentFactor = group.m_factors[i];
+
+		stream << "group of order " << currentFactor.group->order() << " on [" << currentFactor.offset << ", "
+			   << currentFactor.offset + currentFactor.size << ")";
+
+		if (i + 1 < group.m_factors.size()) {
+			stream << ", ";
+		}
+	}
+
+	return stream << " }";
+}
+
+AbstractPermutation::value_type DirectProductGroup::pointCount() const {
+	if (m_factors.empty()) {
+		return 0;
+	}
+
+	return m_factors.back().offset + m_factors.back().size;
+}
+
+std::size_t DirectProductGroup::factorIndex(AbstractPermutation::value_type point) const {
+	// Find the last factor whose block starts at or before the given point
+	auto it = std::upper_bound(m_factors.begin(), m_factors.end(), point,
+							   [](AbstractPermutation::value_type value, const Factor &factor) {
+								   return value < factor.offset;
+							   });
+
+	if (it == m_factors.begin()) {
+		return m_factors.size();
+	}
+
+	--it;
+
+	if (point >= it->offset + it->size) {
+		return m_factors.size();
+	}
+
+	return static_cast< std::size_t >(it - m_factors.begin());
+}
+
+void DirectProductGroup::addFactor(Factor factor) {
+	auto it = std::upper_bound(m_factors.begin(), m_factors.end(), factor.offset,
+							   [](AbstractPermutation::value_type value, const Factor &currentFactor) {
+								   return value < currentFactor.offset;
+							   });
+
+	// Blocks must not overlap
+	assert(it == m_factors.begin() || std::prev(it)->offset + std::prev(it)->size <= factor.offset);
+	assert(it == m_factors.end() || factor.offset + factor.size <= it->offset);
+
+	m_factors.insert(it, std::move(factor));
+}
+
+void DirectProductGroup::mergeSignedFactors() {
+	// If several factors contain the negative identity, the products a * b and (-a) * (-b) of their elements coincide.
+	// Thus, the elements of this group would no longer be unique combinations of the factors' elements (and the order
+	// would no longer be the product of the factors' orders). Therefore, all such factors are merged into a single one
+	// (together with the factors in-between, as blocks have to be contiguous).
+	const ExplicitPermutation negativeIdentity(-1);
+
+	std::size_t first = m_factors.size();
+	std::size_t last  = m_factors.size();
+	for (std::size_t i = 0; i < m_factors.size(); ++i) {
+		if (m_factors[i].group->contains(negativeIdentity)) {
+			first = std::min(first, i);
+			last  = i;
+		}
+	}
+
+	if (first == last) {
+		return;
+	}
+
+	const AbstractPermutation::value_type offset = m_factors[first].offset;
+
+	std::vector< Permutation > generators;
+	for (std::size_t i = first; i <= last; ++i) {
+		for (const Permutation &currentGenerator : m_factors[i].group->getGenerators()) {
+			generators.push_back(
+				shiftedPermutation(currentGenerator.get(), static_cast< int >(m_factors[i].offset - offset)));
+		}
+	}
+
+	Factor merged{ PrimitivePermutationGroup(std::move(generators)), offset,
+				   m_factors[last].offset + m_factors[last].size - offset };
+
+	m_factors.erase(m_factors.begin() + static_cast< std::ptrdiff_t >(first) + 1,
+					m_factors.begin() + static_cast< std::ptrdiff_t >(last) + 1);
+	m_factors[first] = std::move(merged);
+}
+
+void DirectProductGroup::updateGenerators() {
+	m_generators.clear();
+
+	for (const Factor &currentFactor : m_factors) {
+		for (const Permutation &currentGenerator : currentFactor.group->getGenerators()) {
+			if (currentGenerator->isIdentity()) {
+				continue;
+			}
+
+			m_generators.push_back(shiftedPermutation(currentGenerator.get(), static_cast< int >(currentFactor.offset)));
+		}
+	}
+
+	if (m_generators.empty()) {
+		// There is no such thing as an empty group. It must always at least contain the identity element
+		m_generators.emplace_back(ExplicitPermutation());
+	}
+}
+
+} // namespace perm
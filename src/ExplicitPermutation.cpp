@@ -5,6 +5,7 @@
 
 #include "libperm/ExplicitPermutation.hpp"
 #include "libperm/Cycle.hpp"
+#include "libperm/details/Hash.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -13,14 +14,25 @@
 
 namespace perm {
 
+/**
+ * Flag that is temporarily set on image points by the in-place algorithms following the cycles of a permutation in
+ * order to mark points that have already been processed
+ */
+static constexpr AbstractPermutation::value_type processedPointFlag =
+	~(~static_cast< AbstractPermutation::value_type >(0) >> 1);
+
 ExplicitPermutation ExplicitPermutation::fromCycle(const Cycle &cycle, int sign) {
-	return ExplicitPermutation(cycle.toImage< value_type >(), sign);
+	return ExplicitPermutation(cycle, sign);
 }
 
 ExplicitPermutation::ExplicitPermutation(int sign) : details::SignedPermutation(sign), m_image(1, 0) {
 }
 
-ExplicitPermutation::ExplicitPermutation(std::vector< value_type > image, int sign)
+ExplicitPermutation::ExplicitPermutation(const allocator_type &alloc)
+	: details::SignedPermutation(1), m_image(1, 0, alloc) {
+}
+
+ExplicitPermutation::ExplicitPermutation(image_type image, int sign)
 	: details::SignedPermutation(sign), m_image(std::move(image)) {
 	// Assert that the image point contains all points in [0, n) where n = m_image.size()
 	assert(std::accumulate(m_image.begin(), m_image.end(), static_cast< std::size_t >(0))
@@ -34,13 +46,76 @@ ExplicitPermutation::ExplicitPermutation(std::vector< value_type > image, int si
 	}
 }
 
-ExplicitPermutation::ExplicitPermutation(const Cycle &cycle, int sign)
-	: ExplicitPermutation(cycle.toImage< value_type >(), sign) {
+ExplicitPermutation::ExplicitPermutation(const Cycle &cycle, int sign, const allocator_type &alloc)
+	: ExplicitPermutation(cycle.toImage< value_type, allocator_type >(0, alloc), sign) {
+}
+
+ExplicitPermutation::ExplicitPermutation(const AbstractPermutation &other, const allocator_type &alloc)
+	: details::SignedPermutation(other.sign()), m_image(alloc) {
+	const std::size_t n = static_cast< std::size_t >(other.maxElement()) + 1;
+
+	if (const value_type *otherImage = other.contiguousImage()) {
+		m_image.assign(otherImage, otherImage + n);
+	} else {
+		m_image.resize(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			m_image[i] = other.image(static_cast< value_type >(i));
+		}
+	}
+
+	reduceImageRepresentation();
+}
+
+ExplicitPermutation::ExplicitPermutation(const ExplicitPermutation &other)
+	: details::SignedPermutation(other), m_image(other.m_image) {
+#ifdef LIBPERM_CACHE_HASHES
+	m_imageHash.store(other.m_imageHash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+#endif
+}
+
+ExplicitPermutation::ExplicitPermutation(ExplicitPermutation &&other) noexcept
+	: details::SignedPermutation(std::move(other)), m_image(std::move(other.m_image)) {
+#ifdef LIBPERM_CACHE_HASHES
+	m_imageHash.store(other.m_imageHash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	other.m_imageHash.store(0, std::memory_order_relaxed);
+#endif
 }
 
 ExplicitPermutation::~ExplicitPermutation() {
 }
 
+ExplicitPermutation &ExplicitPermutation::operator=(const ExplicitPermutation &other) {
+	details::SignedPermutation::operator=(other);
+	m_image = other.m_image;
+#ifdef LIBPERM_CACHE_HASHES
+	m_imageHash.store(other.m_imageHash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+#endif
+
+	return *this;
+}
+
+ExplicitPermutation &ExplicitPermutation::operator=(ExplicitPermutation &&other) {
+	if (m_image.get_allocator() != other.m_image.get_allocator()) {
+		// Memory can't be exchanged between different resources
+		return *this = static_cast< const ExplicitPermutation & >(other);
+	}
+
+	// Swapping leaves other in a valid state without having to allocate memory for it
+	const int ownSign = sign();
+	setSign(other.sign());
+	other.setSign(ownSign);
+
+	m_image.swap(other.m_image);
+
+#ifdef LIBPERM_CACHE_HASHES
+	const std::size_t otherHash = other.m_imageHash.load(std::memory_order_relaxed);
+	other.m_imageHash.store(m_imageHash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	m_imageHash.store(otherHash, std::memory_order_relaxed);
+#endif
+
+	return *this;
+}
+
 ExplicitPermutation::value_type ExplicitPermutation::maxElement() const {
 	assert(!m_image.empty());
 	return static_cast< value_type >(m_image.size() - 1);
@@ -54,18 +129,66 @@ ExplicitPermutation::value_type ExplicitPermutation::image(value_type value) con
 	}
 }
 
-const std::vector< ExplicitPermutation::value_type > &ExplicitPermutation::image() const {
+ExplicitPermutation::allocator_type ExplicitPermutation::get_allocator() const {
+	return m_image.get_allocator();
+}
+
+const ExplicitPermutation::image_type &ExplicitPermutation::image() const {
 	return m_image;
 }
 
+const ExplicitPermutation::value_type *ExplicitPermutation::contiguousImage() const {
+	return m_image.data();
+}
+
 void ExplicitPermutation::invert() {
-	std::vector< value_type > inverseImage(m_image.size());
+	assert(m_image.size() <= processedPointFlag);
+
+	// Reverse every cycle in-place. Points whose image has already been inverted are flagged.
+	for (std::size_t start = 0; start < m_image.size(); ++start) {
+		if (m_image[start] & processedPointFlag) {
+			continue;
+		}
+
+		value_type previous = static_cast< value_type >(start);
+		value_type current  = m_image[start];
+
+		while (current != start) {
+			const value_type next = m_image[current];
+
+			m_image[current] = previous | processedPointFlag;
+			previous         = current;
+			current          = next;
+		}
 
-	for (value_type i = 0; i < inverseImage.size(); ++i) {
-		inverseImage[m_image[i]] = i;
+		m_image[start] = previous | processedPointFlag;
 	}
 
-	m_image = inverseImage;
+	for (value_type &currentPoint : m_image) {
+		currentPoint &= ~processedPointFlag;
+	}
+
+#ifdef LIBPERM_CACHE_HASHES
+	m_imageHash.store(0, std::memory_order_relaxed);
+#endif
+}
+
+std::size_t ExplicitPermutation::hash() const {
+#ifdef LIBPERM_CACHE_HASHES
+	std::size_t imageHash = m_imageHash.load(std::memory_order_relaxed);
+
+	if (imageHash == 0) {
+		// The identity is stored as { 0 } but has to be hashed like an empty image (see AbstractPermutation::hash)
+		imageHash = details::hashImage(m_image.data(), m_image.size() > 1 ? m_image.size() : 0);
+
+		m_imageHash.store(imageHash, std::memory_order_relaxed);
+	}
+#else
+	// The identity is stored as { 0 } but has to be hashed like an empty image (see AbstractPermutation::hash)
+	const std::size_t imageHash = details::hashImage(m_image.data(), m_image.size() > 1 ? m_image.size() : 0);
+#endif
+
+	return details::hashWithSign(imageHash, sign());
 }
 
 void ExplicitPermutation::preMultiply(const AbstractPermutation &other) {
@@ -78,13 +201,38 @@ void ExplicitPermutation::preMultiply(const AbstractPermutation &other) {
 
 	const value_type overallMaxElement = std::max(maxElement(), other.maxElement());
 
-	decltype(m_image) transformedImage(overallMaxElement + 1);
+	assert(overallMaxElement < processedPointFlag);
+
+	// Extend our image by fixed points, if other acts on more points than we do
+	const std::size_t ownSize = m_image.size();
+	m_image.resize(overallMaxElement + 1);
+	std::iota(m_image.begin() + static_cast< std::ptrdiff_t >(ownSize), m_image.end(),
+			  static_cast< value_type >(ownSize));
+
+	// The new image of i is our current image of other(i). This can be computed in-place by following the cycles of
+	// other: every point takes over the image of its successor in the respective cycle. Points whose image has already
+	// been updated are flagged.
+	for (value_type start = 0; start <= overallMaxElement; ++start) {
+		if (m_image[start] & processedPointFlag) {
+			continue;
+		}
+
+		const value_type startImage = m_image[start];
+		value_type current          = start;
+		value_type next             = other.image(start);
+
+		while (next != start) {
+			m_image[current] = m_image[next] | processedPointFlag;
+			current          = next;
+			next             = other.image(next);
+		}
 
-	for (value_type i = 0; i <= overallMaxElement; ++i) {
-		transformedImage[i] = image(other.image(i));
+		m_image[current] = startImage | processedPointFlag;
 	}
 
-	m_image = std::move(transformedImage);
+	for (value_type &currentPoint : m_image) {
+		currentPoint &= ~processedPointFlag;
+	}
 
 	// Assert that multiplication has not created any duplicate entries
 	assert(std::set< value_type >(m_image.begin(), m_image.end()).size() == m_image.size());
@@ -159,8 +307,12 @@ void ExplicitPermutation::shift(int shift, std::size_t startOffset) {
 
 	// Handle image points i -> j where j >= startOffset
 	for (std::size_t i = 0; i < m_image.size(); ++i) {
-		if ((shift < 0 || m_image[i] != static_cast< value_type >(i))
-			&& m_image[i] >= static_cast< value_type >(startOffset)) {
+		if (shift > 0 && i >= startOffset && i < startOffset + static_cast< std::size_t >(shift)) {
+			// These are the newly inserted fixed points
+			continue;
+		}
+
+		if (m_image[i] >= static_cast< value_type >(startOffset)) {
 			assert(shift >= 0 || m_image[i] >= static_cast< value_type >(-shift));
 
 			m_image[i] += shift;
@@ -205,15 +357,149 @@ ExplicitPermutation operator*(const ExplicitPermutation &lhs, const ExplicitPerm
 	return result;
 }
 
+ExplicitPermutation operator*(ExplicitPermutation &&lhs, const AbstractPermutation &rhs) {
+	// Reuse the memory of the temporary
+	ExplicitPermutation result(std::move(lhs));
+
+	result.postMultiply(rhs);
+
+	return result;
+}
+
+ExplicitPermutation operator*(ExplicitPermutation &&lhs, const ExplicitPermutation &rhs) {
+	return std::move(lhs) * static_cast< const AbstractPermutation & >(rhs);
+}
+
+void composeInto(ExplicitPermutation &destination, const AbstractPermutation &lhs, const AbstractPermutation &rhs) {
+	if (&destination == &lhs) {
+		destination.postMultiply(rhs);
+		return;
+	}
+	if (&destination == &rhs) {
+		destination.preMultiply(lhs);
+		return;
+	}
+
+	const ExplicitPermutation::value_type n = std::max(lhs.maxElement(), rhs.maxElement()) + 1;
+
+	destination.m_image.resize(n);
+	for (ExplicitPermutation::value_type i = 0; i < n; ++i) {
+		destination.m_image[i] = rhs.image(lhs.image(i));
+	}
+
+	destination.setSign(lhs.sign() * rhs.sign());
+
+	destination.reduceImageRepresentation();
+}
+
+void invertInto(ExplicitPermutation &destination, const AbstractPermutation &source) {
+	if (&destination == &source) {
+		destination.invert();
+		return;
+	}
+
+	const ExplicitPermutation::value_type n = source.maxElement() + 1;
+
+	destination.m_image.resize(n);
+	for (ExplicitPermutation::value_type i = 0; i < n; ++i) {
+		destination.m_image[source.image(i)] = i;
+	}
+
+	destination.setSign(source.sign());
+
+	destination.reduceImageRepresentation();
+}
+
+ExplicitPermutation power(const AbstractPermutation &perm, std::int64_t k,
+						  const ExplicitPermutation::allocator_type &alloc) {
+	const ExplicitPermutation::value_type n = perm.maxElement() + 1;
+
+	// Points that have not been assigned an image yet are marked by an (invalid) image of n
+	ExplicitPermutation::image_type image(n, n, alloc);
+	std::vector< ExplicitPermutation::value_type > cycle;
+
+	for (ExplicitPermutation::value_type start = 0; start < n; ++start) {
+		if (image[start] != n) {
+			continue;
+		}
+
+		cycle.clear();
+		ExplicitPermutation::value_type current = start;
+		do {
+			cycle.push_back(current);
+			current = perm.image(current);
+		} while (current != start);
+
+		// Within a cycle of length l, the k-th power maps every point to the one k positions ahead (modulo l)
+		const std::int64_t length = static_cast< std::int64_t >(cycle.size());
+		const std::size_t offset  = static_cast< std::size_t >(((k % length) + length) % length);
+
+		for (std::size_t j = 0; j < cycle.size(); ++j) {
+			image[cycle[j]] = cycle[(j + offset) % cycle.size()];
+		}
+	}
+
+	const bool negative = perm.sign() < 0 && (k % 2 != 0);
+
+	return ExplicitPermutation(std::move(image), negative ? -1 : 1);
+}
+
+std::size_t order(const AbstractPermutation &perm) {
+	const ExplicitPermutation::value_type n = perm.maxElement() + 1;
+
+	std::vector< bool > visited(n, false);
+	std::size_t result = 1;
+
+	for (ExplicitPermutation::value_type start = 0; start < n; ++start) {
+		if (visited[start]) {
+			continue;
+		}
+
+		std::size_t length                      = 0;
+		ExplicitPermutation::value_type current = start;
+		do {
+			visited[current] = true;
+			current          = perm.image(current);
+			++length;
+		} while (current != start);
+
+		result = std::lcm(result, length);
+	}
+
+	if (perm.sign() < 0 && result % 2 != 0) {
+		// An odd power of a negative permutation is negative as well
+		result *= 2;
+	}
+
+	return result;
+}
+
 void ExplicitPermutation::selfMultiply() {
-	decltype(m_image) transformedImage;
-	transformedImage.resize(m_image.size());
+	assert(m_image.size() <= processedPointFlag);
+
+	// Every point in a cycle c_0 -> c_1 -> ... -> c_(k-1) has to be mapped to the point two steps ahead in that cycle.
+	// This is done in-place by following each cycle once (flagging updated points), which only requires remembering
+	// the original image of the cycle's first point, as that is overwritten first.
+	for (std::size_t start = 0; start < m_image.size(); ++start) {
+		if (m_image[start] & processedPointFlag) {
+			continue;
+		}
 
-	for (std::size_t i = 0; i < m_image.size(); ++i) {
-		transformedImage[i] = m_image[m_image[i]];
+		const value_type startImage = m_image[start];
+		value_type current          = static_cast< value_type >(start);
+
+		do {
+			const value_type next     = m_image[current];
+			const value_type nextNext = next == start ? startImage : m_image[next];
+
+			m_image[current] = nextNext | processedPointFlag;
+			current          = next;
+		} while (current != start);
 	}
 
-	m_image = std::move(transformedImage);
+	for (value_type &currentPoint : m_image) {
+		currentPoint &= ~processedPointFlag;
+	}
 
 	// Assert that multiplication has not created any duplicate entries
 	assert(std::set< value_type >(m_image.begin(), m_image.end()).size() == m_image.size());
@@ -224,6 +510,11 @@ void ExplicitPermutation::selfMultiply() {
 void ExplicitPermutation::reduceImageRepresentation() {
 	assert(!m_image.empty());
 
+#ifdef LIBPERM_CACHE_HASHES
+	// This function is called after every modification of the image
+	m_imageHash.store(0, std::memory_order_relaxed);
+#endif
+
 	// Shrink transformedImage by all righthand entries that map to themselves
 	// (but ensure to keep at least a single entry)
 	value_type i;
@@ -0,0 +1,158 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/GroupRegistry.hpp"
+#include "libperm/ExplicitPermutation.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace perm {
+
+GroupRegistry &GroupRegistry::global() {
+	static GroupRegistry registry;
+
+	return registry;
+}
+
+std::shared_ptr< const PrimitivePermutationGroup > GroupRegistry::get(const std::vector< Permutation > &generators) {
+	Key key = canonicalize(generators);
+
+	std::promise< std::shared_ptr< const PrimitivePermutationGroup > > promise;
+	std::shared_future< std::shared_ptr< const PrimitivePermutationGroup > > existingGroup;
+
+	{
+		std::lock_guard< std::mutex > guard(m_mutex);
+
+		auto it = m_groups.find(key);
+		if (it != m_groups.end()) {
+			m_statistics.hits++;
+
+			existingGroup = it->second.group;
+		} else {
+			m_statistics.misses++;
+			m_statistics.groups++;
+
+			// Register the group before generating it, so that concurrent requests for the same group wait for this
+			// one instead of generating the group as well
+			m_groups.emplace(key, Entry{ promise.get_future().share(), 0 });
+		}
+	}
+
+	if (existingGroup.valid()) {
+		// Note: This might have to wait for a concurrent request that is still generating the group
+		return existingGroup.get();
+	}
+
+	std::shared_ptr< PrimitivePermutationGroup > group;
+	std::size_t memory = 0;
+
+	try {
+		std::vector< Permutation > canonicalGenerators;
+		canonicalGenerators.reserve(key.size());
+
+		std::size_t degree = 0;
+		for (const GeneratorKey &currentGenerator : key) {
+			degree = std::max(degree, currentGenerator.second.size());
+
+			canonicalGenerators.push_back(ExplicitPermutation(currentGenerator.second, currentGenerator.first));
+		}
+
+		group = std::make_shared< PrimitivePermutationGroup >(std::move(canonicalGenerators));
+
+		// Generate the elements while we are still the only ones having access to the group. No element acts on more
+		// points than the generators do, which bounds the memory used by each of them.
+		memory = group->order() * (sizeof(Permutation) + degree * sizeof(AbstractPermutation::value_type));
+	} catch (...) {
+		{
+			std::lock_guard< std::mutex > guard(m_mutex);
+
+			// Don't keep the failed group around, so that later requests can try again
+			if (m_groups.erase(key) > 0) {
+				m_statistics.groups--;
+			}
+		}
+
+		// Concurrent requests for the same group that are waiting for this one, receive the same exception
+		promise.set_exception(std::current_exception());
+
+		throw;
+	}
+
+	{
+		std::lock_guard< std::mutex > guard(m_mutex);
+
+		auto it = m_groups.find(key);
+		if (it != m_groups.end()) {
+			it->second.memory = memory;
+			m_statistics.memory += memory;
+		}
+	}
+
+	promise.set_value(group);
+
+	return group;
+}
+
+GroupRegistry::Statistics GroupRegistry::statistics() const {
+	std::lock_guard< std::mutex > guard(m_mutex);
+
+	return m_statistics;
+}
+
+void GroupRegistry::clear() {
+	std::lock_guard< std::mutex > guard(m_mutex);
+
+	m_groups.clear();
+	m_statistics = {};
+}
+
+std::size_t GroupRegistry::KeyHash::operator()(const Key &key) const {
+	// Combine the hashes of the individual images in the same way boost::hash_combine does
+	std::size_t hash = key.size();
+
+	for (const GeneratorKey &currentGenerator : key) {
+		hash ^= std::hash< int >{}(currentGenerator.first) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+		for (AbstractPermutation::value_type currentImage : currentGenerator.second) {
+			hash ^= std::hash< AbstractPermutation::value_type >{}(currentImage) + 0x9e3779b9 + (hash << 6)
+					+ (hash >> 2);
+		}
+	}
+
+	return hash;
+}
+
+GroupRegistry::Key GroupRegistry::canonicalize(const std::vector< Permutation > &generators) {
+	Key key;
+	key.reserve(generators.size());
+
+	for (const Permutation &currentGenerator : generators) {
+		if (currentGenerator->isIdentity() && currentGenerator->sign() > 0) {
+			continue;
+		}
+
+		AbstractPermutation::value_type lastMovedPoint = 0;
+		for (AbstractPermutation::value_type i = 0; i <= currentGenerator->maxElement(); ++i) {
+			if (currentGenerator->image(i) != i) {
+				lastMovedPoint = i;
+			}
+		}
+
+		std::vector< AbstractPermutation::value_type > image(lastMovedPoint + 1);
+		for (AbstractPermutation::value_type i = 0; i <= lastMovedPoint; ++i) {
+			image[i] = currentGenerator->image(i);
+		}
+
+		key.emplace_back(currentGenerator->sign(), std::move(image));
+	}
+
+	std::sort(key.begin(), key.end());
+	key.erase(std::unique(key.begin(), key.end()), key.end());
+
+	return key;
+}
+
+} // namespace perm
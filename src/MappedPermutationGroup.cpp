@@ -0,0 +1,579 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/MappedPermutationGroup.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+namespace perm {
+
+static constexpr char formatMagic[8]          = { 'L', 'I', 'B', 'P', 'E', 'R', 'M', 'G' };
+static constexpr std::uint32_t byteOrderMark  = 0x01020304;
+static constexpr std::size_t formatHeaderSize = 88;
+static constexpr std::size_t formatAlignment  = 8;
+
+/**
+ * The part of the header following the magic bytes
+ */
+struct MappedFormatHeader {
+	std::uint32_t version;
+	std::uint32_t byteOrderMark;
+	/**
+	 * Bit 0 is reserved for indicating the presence of BSGS data, which is not part of version 1 of the format
+	 */
+	std::uint32_t flags;
+	std::uint32_t degree;
+	std::uint32_t pointWidth;
+	std::uint32_t reserved;
+	std::uint64_t generatorCount;
+	std::uint64_t order;
+	std::uint64_t generatorOffset;
+	std::uint64_t generatorSignOffset;
+	std::uint64_t elementOffset;
+	std::uint64_t elementSignOffset;
+	std::uint64_t totalSize;
+};
+
+static_assert(sizeof(formatMagic) + sizeof(MappedFormatHeader) == formatHeaderSize, "Unexpected header layout");
+
+/**
+ * @returns The given offset rounded up to the next multiple of the format's alignment
+ */
+static std::uint64_t alignFormatOffset(std::uint64_t offset) {
+	return (offset + formatAlignment - 1) / formatAlignment * formatAlignment;
+}
+
+/**
+ * @returns The amount of points that the given permutations act on non-trivially (at least 1)
+ */
+static AbstractPermutation::value_type formatDegree(const std::vector< Permutation > &perms) {
+	AbstractPermutation::value_type degree = 1;
+
+	for (const Permutation &currentPerm : perms) {
+		for (AbstractPermutation::value_type i = 0; i <= currentPerm->maxElement(); ++i) {
+			if (currentPerm->image(i) != i) {
+				degree = std::max(degree, i + 1);
+			}
+		}
+	}
+
+	return degree;
+}
+
+/**
+ * Writes the packed images and the signs of the given permutations as two separate (aligned) sections
+ */
+static void writeFormatTable(std::ostream &stream, const std::vector< Permutation > &perms,
+							 AbstractPermutation::value_type degree, std::uint32_t pointWidth,
+							 std::uint64_t &position) {
+	std::vector< unsigned char > buffer(static_cast< std::size_t >(degree) * pointWidth);
+
+	for (const Permutation &currentPerm : perms) {
+		for (AbstractPermutation::value_type i = 0; i < degree; ++i) {
+			const std::uint32_t image = currentPerm->image(i);
+
+			switch (pointWidth) {
+				case 1: {
+					const std::uint8_t value = static_cast< std::uint8_t >(image);
+					std::memcpy(buffer.data() + i, &value, sizeof(value));
+					break;
+				}
+				case 2: {
+					const std::uint16_t value = static_cast< std::uint16_t >(image);
+					std::memcpy(buffer.data() + 2 * static_cast< std::size_t >(i), &value, sizeof(value));
+					break;
+				}
+				default:
+					std::memcpy(buffer.data() + 4 * static_cast< std::size_t >(i), &image, sizeof(image));
+					break;
+			}
+		}
+
+		stream.write(reinterpret_cast< const char * >(buffer.data()), static_cast< std::streamsize >(buffer.size()));
+		position += buffer.size();
+	}
+
+	const std::uint64_t signStart = alignFormatOffset(position);
+	for (; position < signStart; ++position) {
+		stream.put(0);
+	}
+
+	std::vector< unsigned char > signs((perms.size() + 7) / 8, 0);
+	for (std::size_t i = 0; i < perms.size(); ++i) {
+		if (perms[i]->sign() < 0) {
+			signs[i / 8] |= static_cast< unsigned char >(1u << (i % 8));
+		}
+	}
+
+	stream.write(reinterpret_cast< const char * >(signs.data()), static_cast< std::streamsize >(signs.size()));
+	position += signs.size();
+
+	const std::uint64_t end = alignFormatOffset(position);
+	for (; position < end; ++position) {
+		stream.put(0);
+	}
+}
+
+/**
+ * @returns The image of the given point under the permutation stored in the given row of the given table
+ */
+static AbstractPermutation::value_type readFormatImage(const unsigned char *table, std::size_t row,
+													   AbstractPermutation::value_type point,
+													   AbstractPermutation::value_type degree,
+													   std::uint32_t pointWidth) {
+	const unsigned char *location = table + (row * degree + point) * pointWidth;
+
+	switch (pointWidth) {
+		case 1:
+			return *location;
+		case 2: {
+			std::uint16_t value;
+			std::memcpy(&value, location, sizeof(value));
+			return value;
+		}
+		default: {
+			std::uint32_t value;
+			std::memcpy(&value, location, sizeof(value));
+			return value;
+		}
+	}
+}
+
+/**
+ * @returns The sign of the permutation in the given row of the table to which the given signs belong
+ */
+static int readFormatSign(const unsigned char *signs, std::size_t row) {
+	return ((signs[row / 8] >> (row % 8)) & 1u) ? -1 : 1;
+}
+
+/**
+ * @returns Whether count entries of the given size that start at the given offset end at or before the given limit.
+ * In contrast to comparing offset + count * entrySize against the limit, this can't overflow.
+ */
+static bool formatRegionFits(std::uint64_t offset, std::uint64_t count, std::uint64_t entrySize, std::uint64_t limit) {
+	return offset <= limit && (entrySize == 0 || count <= (limit - offset) / entrySize);
+}
+
+/**
+ * @returns The amount of bytes needed to store the signs of the given amount of permutations
+ */
+static std::uint64_t formatSignBytes(std::uint64_t count) {
+	return count / 8 + (count % 8 != 0 ? 1 : 0);
+}
+
+/**
+ * @returns Whether every row of the given table is a permutation of the points 0, ..., degree - 1
+ */
+static bool isValidFormatTable(const unsigned char *table, std::size_t rows, AbstractPermutation::value_type degree,
+							   std::uint32_t pointWidth) {
+	// Stores the (1-based) index of the row in which a point has been seen last, so it never has to be reset
+	std::vector< std::size_t > seenInRow(degree, 0);
+
+	for (std::size_t row = 0; row < rows; ++row) {
+		for (AbstractPermutation::value_type i = 0; i < degree; ++i) {
+			const AbstractPermutation::value_type image = readFormatImage(table, row, i, degree, pointWidth);
+
+			if (image >= degree || seenInRow[image] == row + 1) {
+				return false;
+			}
+
+			seenInRow[image] = row + 1;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @returns A negative value, zero or a positive value, if the permutation in the row lhs of the given table comes
+ * before, is equal to or comes after the one in the row rhs in the order established by compare()
+ */
+static int compareFormatRows(const unsigned char *table, const unsigned char *signs, std::size_t lhs, std::size_t rhs,
+							 AbstractPermutation::value_type degree, std::uint32_t pointWidth) {
+	for (AbstractPermutation::value_type i = 0; i < degree; ++i) {
+		const AbstractPermutation::value_type lhsImage = readFormatImage(table, lhs, i, degree, pointWidth);
+		const AbstractPermutation::value_type rhsImage = readFormatImage(table, rhs, i, degree, pointWidth);
+
+		if (lhsImage != rhsImage) {
+			return lhsImage < rhsImage ? -1 : 1;
+		}
+	}
+
+	return readFormatSign(signs, lhs) - readFormatSign(signs, rhs);
+}
+
+/**
+ * @returns Whether the rows of the given table are strictly ascending in the order established by compare()
+ */
+static bool isSortedFormatTable(const unsigned char *table, const unsigned char *signs, std::size_t rows,
+								AbstractPermutation::value_type degree, std::uint32_t pointWidth) {
+	for (std::size_t row = 1; row < rows; ++row) {
+		if (compareFormatRows(table, signs, row - 1, row, degree, pointWidth) >= 0) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @returns The permutation stored in the given row of the given table
+ */
+static ExplicitPermutation readFormatRow(const unsigned char *table, const unsigned char *signs, std::size_t row,
+										 AbstractPermutation::value_type degree, std::uint32_t pointWidth) {
+	ExplicitPermutation::image_type image(degree);
+
+	for (AbstractPermutation::value_type i = 0; i < degree; ++i) {
+		image[i] = readFormatImage(table, row, i, degree, pointWidth);
+	}
+
+	return ExplicitPermutation(std::move(image), readFormatSign(signs, row));
+}
+
+bool MappedPermutationGroup::write(const AbstractPermutationGroup &group, std::ostream &stream) {
+	std::vector< Permutation > elements;
+	group.getElementsTo(elements);
+
+	// A sorted element table allows for looking up elements via binary search
+	std::sort(elements.begin(), elements.end(), [](const Permutation &lhs, const Permutation &rhs) {
+		return compare(lhs.get(), rhs.get()) < 0;
+	});
+
+	const std::vector< Permutation > &generators = group.getGenerators();
+
+	const AbstractPermutation::value_type degree =
+		std::max(formatDegree(elements), formatDegree(generators));
+	const std::uint32_t pointWidth = degree <= 0x100 ? 1 : (degree <= 0x10000 ? 2 : 4);
+
+	const std::uint64_t rowSize = static_cast< std::uint64_t >(degree) * pointWidth;
+
+	MappedFormatHeader header;
+	header.version             = formatVersion;
+	header.byteOrderMark       = byteOrderMark;
+	header.flags               = 0;
+	header.degree              = degree;
+	header.pointWidth          = pointWidth;
+	header.reserved            = 0;
+	header.generatorCount      = generators.size();
+	header.order               = elements.size();
+	header.generatorOffset     = formatHeaderSize;
+	header.generatorSignOffset = alignFormatOffset(header.generatorOffset + generators.size() * rowSize);
+	header.elementOffset       = alignFormatOffset(header.generatorSignOffset + (generators.size() + 7) / 8);
+	header.elementSignOffset   = alignFormatOffset(header.elementOffset + elements.size() * rowSize);
+	header.totalSize           = alignFormatOffset(header.elementSignOffset + (elements.size() + 7) / 8);
+
+	stream.write(formatMagic, sizeof(formatMagic));
+	stream.write(reinterpret_cast< const char * >(&header), sizeof(header));
+
+	std::uint64_t position = formatHeaderSize;
+	writeFormatTable(stream, generators, degree, pointWidth, position);
+	assert(position == header.elementOffset);
+	writeFormatTable(stream, elements, degree, pointWidth, position);
+	assert(position == header.totalSize);
+
+	return static_cast< bool >(stream);
+}
+
+std::optional< MappedPermutationGroup > MappedPermutationGroup::open(const std::string &path) {
+	details::MappedFile file(path);
+
+	if (!file.isOpen()) {
+		return {};
+	}
+
+	MappedPermutationGroup group;
+
+	if (!group.load(file.data(), file.size())) {
+		return {};
+	}
+
+	group.m_file = std::move(file);
+
+	return group;
+}
+
+std::optional< MappedPermutationGroup > MappedPermutationGroup::fromBuffer(const void *data, std::size_t size) {
+	MappedPermutationGroup group;
+
+	if (!group.load(static_cast< const unsigned char * >(data), size)) {
+		return {};
+	}
+
+	return group;
+}
+
+MappedPermutationGroup::MappedPermutationGroup() : AbstractPermutationGroup(PermutationGroupType::Mapped) {
+}
+
+AbstractPermutation::value_type MappedPermutationGroup::degree() const {
+	return m_degree;
+}
+
+bool MappedPermutationGroup::load(const unsigned char *data, std::size_t size) {
+	if (!data || size < formatHeaderSize || reinterpret_cast< std::uintptr_t >(data) % formatAlignment != 0
+		|| std::memcmp(data, formatMagic, sizeof(formatMagic)) != 0) {
+		return false;
+	}
+
+	MappedFormatHeader header;
+	std::memcpy(&header, data + sizeof(formatMagic), sizeof(header));
+
+	if (header.version != formatVersion || header.byteOrderMark != byteOrderMark || header.totalSize > size
+		|| header.degree == 0 || header.order == 0 || header.generatorCount == 0
+		|| (header.pointWidth != 1 && header.pointWidth != 2 && header.pointWidth != 4)) {
+		return false;
+	}
+
+	const std::uint64_t rowSize = static_cast< std::uint64_t >(header.degree) * header.pointWidth;
+
+	// The sections have to be ordered and fit into the buffer. As the header may have been corrupted (deliberately or
+	// not), all of this has to be checked without risking overflows.
+	if (header.generatorOffset < formatHeaderSize
+		|| !formatRegionFits(header.generatorOffset, header.generatorCount, rowSize, header.generatorSignOffset)
+		|| !formatRegionFits(header.generatorSignOffset, formatSignBytes(header.generatorCount), 1,
+							 header.elementOffset)
+		|| !formatRegionFits(header.elementOffset, header.order, rowSize, header.elementSignOffset)
+		|| !formatRegionFits(header.elementSignOffset, formatSignBytes(header.order), 1, header.totalSize)) {
+		return false;
+	}
+
+	// All accesses to the tables rely on the images being valid points, so this is checked once up front
+	if (!isValidFormatTable(data + header.generatorOffset, static_cast< std::size_t >(header.generatorCount),
+							header.degree, header.pointWidth)
+		|| !isValidFormatTable(data + header.elementOffset, static_cast< std::size_t >(header.order), header.degree,
+							   header.pointWidth)
+		|| !isSortedFormatTable(data + header.elementOffset, data + header.elementSignOffset,
+								static_cast< std::size_t >(header.order), header.degree, header.pointWidth)) {
+		return false;
+	}
+
+	m_degree       = header.degree;
+	m_pointWidth   = header.pointWidth;
+	m_order        = static_cast< std::size_t >(header.order);
+	m_elements     = data + header.elementOffset;
+	m_elementSigns = data + header.elementSignOffset;
+
+	// The generators are the only part that is copied out of the mapped memory
+	m_generators.clear();
+	m_generators.reserve(static_cast< std::size_t >(header.generatorCount));
+
+	for (std::size_t i = 0; i < header.generatorCount; ++i) {
+		m_generators.push_back(readFormatRow(data + header.generatorOffset, data + header.generatorSignOffset, i,
+											 m_degree, m_pointWidth));
+	}
+
+	return true;
+}
+
+AbstractPermutation::value_type MappedPermutationGroup::image(std::size_t row,
+															  AbstractPermutation::value_type point) const {
+	assert(row < m_order);
+	assert(point < m_degree);
+
+	return readFormatImage(m_elements, row, point, m_degree, m_pointWidth);
+}
+
+int MappedPermutationGroup::sign(std::size_t row) const {
+	assert(row < m_order);
+
+	return readFormatSign(m_elementSigns, row);
+}
+
+ExplicitPermutation MappedPermutationGroup::element(std::size_t row) const {
+	assert(row < m_order);
+
+	return readFormatRow(m_elements, m_elementSigns, row, m_degree, m_pointWidth);
+}
+
+std::vector< AbstractPermutation::value_type >
+	MappedPermutationGroup::orbit(AbstractPermutation::value_type point) const {
+	if (point >= m_degree) {
+		return { point };
+	}
+
+	// Breadth-first search over the generators, which is independent of the group's order
+	std::vector< AbstractPermutation::value_type > orbit = { point };
+	std::vector< bool > contained(m_degree, false);
+	contained[point] = true;
+
+	for (std::size_t pos = 0; pos < orbit.size(); ++pos) {
+		for (const Permutation &currentGenerator : m_generators) {
+			const AbstractPermutation::value_type currentImage = currentGenerator->image(orbit[pos]);
+
+			if (!contained[currentImage]) {
+				contained[currentImage] = true;
+				orbit.push_back(currentImage);
+			}
+		}
+	}
+
+	return orbit;
+}
+
+std::size_t MappedPermutationGroup::order() const {
+	return m_order;
+}
+
+bool MappedPermutationGroup::contains(const AbstractPermutation &perm) const {
+	return rank(perm) != m_order;
+}
+
+bool MappedPermutationGroup::addGenerator(Permutation perm) {
+	// The group's elements are stored in read-only memory and thus it can't be extended
+	if (!contains(perm.get())) {
+		throw std::invalid_argument("Mapped groups can't be extended by additional generators");
+	}
+
+	return false;
+}
+
+void MappedPermutationGroup::setGenerators(std::vector< Permutation > generators) {
+	// The group's elements are stored in read-only memory and thus its generators can't be changed
+	if (!std::all_of(generators.begin(), generators.end(),
+					 [this](const Permutation &current) { return contains(current.get()); })) {
+		throw std::invalid_argument("Mapped groups can't be extended by additional generators");
+	}
+}
+
+const std::vector< Permutation > &MappedPermutationGroup::getGenerators() const {
+	return m_generators;
+}
+
+void MappedPermutationGroup::getElementsTo(std::vector< Permutation > &permutations) const {
+	permutations.clear();
+	permutations.reserve(m_order);
+
+	for (std::size_t row = 0; row < m_order; ++row) {
+		permutations.push_back(element(row));
+	}
+}
+
+std::size_t MappedPermutationGroup::rank(const AbstractPermutation &perm) const {
+	for (AbstractPermutation::value_type i = m_degree; i <= perm.maxElement(); ++i) {
+		if (perm.image(i) != i) {
+			return m_order;
+		}
+	}
+
+	// The rank of an element is its row in the element table, which is sorted in the order established by compare()
+	auto compareToRow = [this, &perm](std::size_t row) {
+		for (AbstractPermutation::value_type i = 0; i < m_degree; ++i) {
+			const AbstractPermutation::value_type rowImage  = image(row, i);
+			const AbstractPermutation::value_type permImage = perm.image(i);
+
+			if (rowImage != permImage) {
+				return rowImage < permImage ? -1 : 1;
+			}
+		}
+
+		return sign(row) - perm.sign();
+	};
+
+	std::size_t first = 0;
+	std::size_t last  = m_order;
+	while (first < last) {
+		const std::size_t middle = first + (last - first) / 2;
+		const int comparison     = compareToRow(middle);
+
+		if (comparison == 0) {
+			return middle;
+		} else if (comparison < 0) {
+			first = middle + 1;
+		} else {
+			last = middle;
+		}
+	}
+
+	return m_order;
+}
+
+Permutation MappedPermutationGroup::unrank(std::size_t rank) const {
+	assert(rank < m_order);
+
+	return element(rank);
+}
+
+std::vector< Permutation > MappedPermutationGroup::leftCoset(const AbstractPermutation &perm) const {
+	std::vector< Permutation > coset;
+	coset.reserve(m_order);
+
+	for (std::size_t row = 0; row < m_order; ++row) {
+		ExplicitPermutation currentElement = element(row);
+		currentElement.preMultiply(perm);
+
+		coset.push_back(std::move(currentElement));
+	}
+
+	return coset;
+}
+
+std::vector< Permutation > MappedPermutationGroup::rightCoset(const AbstractPermutation &perm) const {
+	std::vector< Permutation > coset;
+	coset.reserve(m_order);
+
+	for (std::size_t row = 0; row < m_order; ++row) {
+		ExplicitPermutation currentElement = element(row);
+		currentElement.postMultiply(perm);
+
+		coset.push_back(std::move(currentElement));
+	}
+
+	return coset;
+}
+
+template< bool left > Permutation MappedPermutationGroup::cosetRepresentative(const AbstractPermutation &perm) const {
+	// Find the coset element with the lexicographically smallest image without explicitly creating the coset
+	const AbstractPermutation::value_type n = std::max(m_degree, perm.maxElement() + 1);
+
+	auto elementImage = [this](std::size_t row, AbstractPermutation::value_type point) {
+		return point < m_degree ? image(row, point) : point;
+	};
+
+	ExplicitPermutation::image_type bestImage;
+	ExplicitPermutation::image_type currentImage(n);
+	int bestSign = 1;
+
+	for (std::size_t row = 0; row < m_order; ++row) {
+		for (AbstractPermutation::value_type i = 0; i < n; ++i) {
+			if constexpr (left) {
+				// Apply perm first and then the group element
+				currentImage[i] = elementImage(row, perm.image(i));
+			} else {
+				// Apply the group element first and then perm
+				currentImage[i] = perm.image(elementImage(row, i));
+			}
+		}
+
+		const int currentSign = sign(row) * perm.sign();
+
+		// Consistent with compare(), negative signs come first for equal images (which occurs, if the group contains
+		// the negative identity)
+		if (bestImage.empty() || currentImage < bestImage || (currentImage == bestImage && currentSign < bestSign)) {
+			bestImage = currentImage;
+			bestSign  = currentSign;
+		}
+	}
+
+	return ExplicitPermutation(std::move(bestImage), bestSign);
+}
+
+Permutation MappedPermutationGroup::leftCosetRepresentative(const AbstractPermutation &perm) const {
+	return cosetRepresentative< true >(perm);
+}
+
+Permutation MappedPermutationGroup::rightCosetRepresentative(const AbstractPermutation &perm) const {
+	return cosetRepresentative< false >(perm);
+}
+
+std::ostream &operator<<(std::ostream &stream, const MappedPermutationGroup &group) {
+	return stream << "mapped group of order " << group.m_order << " over " << group.m_degree << " points";
+}
+
+} // namespace perm
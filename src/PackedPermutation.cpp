@@ -0,0 +1,272 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/PackedPermutation.hpp"
+#include "libperm/details/Hash.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+#if defined(__SSSE3__) && defined(__x86_64__)
+#	include <tmmintrin.h>
+#	define LIBPERM_PACKED_SHUFFLE_SSSE3
+#endif
+
+namespace perm {
+
+/**
+ * Makes sure that the given point can be represented in a packed image
+ *
+ * @throws std::out_of_range if the point is bigger than 15
+ */
+static void checkPackedPoint(std::size_t point) {
+	if (point >= PackedPermutation::max_points) {
+		throw std::out_of_range("PackedPermutation can only act on the points 0, ..., 15 (got "
+								+ std::to_string(point) + ")");
+	}
+}
+
+/**
+ * @returns The 4-bit entry of the given packed image that holds the image of the given point
+ */
+static constexpr PackedPermutation::packed_type packedNibble(PackedPermutation::packed_type packedImage,
+															 std::size_t point) {
+	return (packedImage >> (4 * point)) & 0xF;
+}
+
+#ifdef LIBPERM_PACKED_SHUFFLE_SSSE3
+/**
+ * @returns A vector whose i-th byte holds the i-th nibble of the given packed image
+ */
+static __m128i unpackNibbles(PackedPermutation::packed_type packedImage) {
+	const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+	const __m128i packed     = _mm_cvtsi64_si128(static_cast< long long >(packedImage));
+
+	const __m128i lowNibbles  = _mm_and_si128(packed, nibbleMask);
+	const __m128i highNibbles = _mm_and_si128(_mm_srli_epi16(packed, 4), nibbleMask);
+
+	return _mm_unpacklo_epi8(lowNibbles, highNibbles);
+}
+#endif
+
+/**
+ * @returns The packed image of the permutation that maps every point p to outer(inner(p))
+ */
+static PackedPermutation::packed_type composePacked(PackedPermutation::packed_type inner,
+													PackedPermutation::packed_type outer) {
+#ifdef LIBPERM_PACKED_SHUFFLE_SSSE3
+	// Use inner's images as indices into outer's images (a single byte shuffle) and then pack pairs of bytes back into
+	// single bytes via b_{2k} + 16 * b_{2k+1}
+	const __m128i shuffled = _mm_shuffle_epi8(unpackNibbles(outer), unpackNibbles(inner));
+	const __m128i combined = _mm_maddubs_epi16(shuffled, _mm_set1_epi16(0x1001));
+
+	return static_cast< PackedPermutation::packed_type >(_mm_cvtsi128_si64(_mm_packus_epi16(combined, combined)));
+#else
+	PackedPermutation::packed_type result = 0;
+
+	for (std::size_t i = 0; i < PackedPermutation::max_points; ++i) {
+		result |= packedNibble(outer, static_cast< std::size_t >(packedNibble(inner, i))) << (4 * i);
+	}
+
+	return result;
+#endif
+}
+
+/**
+ * @returns The packed image of the given permutation
+ * @throws std::out_of_range if the permutation moves any point beyond 15
+ */
+static PackedPermutation::packed_type packImageOf(const AbstractPermutation &perm) {
+	if (const PackedPermutation *packed = dynamic_cast< const PackedPermutation * >(&perm)) {
+		return packed->packedImage();
+	}
+
+	checkPackedPoint(perm.maxElement());
+
+	PackedPermutation::packed_type packedImage = 0;
+	for (std::size_t i = 0; i < PackedPermutation::max_points; ++i) {
+		packedImage |= static_cast< PackedPermutation::packed_type >(perm.image(static_cast< unsigned int >(i)))
+					   << (4 * i);
+	}
+
+	return packedImage;
+}
+
+/**
+ * @returns Whether the given packed image contains every point 0, ..., 15 exactly once
+ */
+[[maybe_unused]] static bool isPackedBijection(PackedPermutation::packed_type packedImage) {
+	std::uint32_t seen = 0;
+	for (std::size_t i = 0; i < PackedPermutation::max_points; ++i) {
+		seen |= std::uint32_t(1) << packedNibble(packedImage, i);
+	}
+
+	return seen == 0xFFFF;
+}
+
+PackedPermutation PackedPermutation::fromPackedImage(packed_type packedImage, int sign) {
+	assert(isPackedBijection(packedImage));
+
+	PackedPermutation perm(sign);
+	perm.m_image = packedImage;
+
+	return perm;
+}
+
+PackedPermutation::PackedPermutation(int sign) : details::SignedPermutation(sign) {
+}
+
+PackedPermutation::PackedPermutation(const std::vector< value_type > &image, int sign)
+	: details::SignedPermutation(sign) {
+	for (std::size_t i = 0; i < image.size(); ++i) {
+		if (image[i] == i) {
+			// Fixed points (possibly beyond 15) are already part of the identity image
+			continue;
+		}
+
+		checkPackedPoint(std::max< std::size_t >(i, image[i]));
+
+		m_image &= ~(packed_type(0xF) << (4 * i));
+		m_image |= static_cast< packed_type >(image[i]) << (4 * i);
+	}
+
+	assert(isPackedBijection(m_image));
+}
+
+PackedPermutation::PackedPermutation(const Cycle &cycle, int sign) : details::SignedPermutation(sign) {
+	for (const Cycle::Span currentCycle : cycle) {
+		for (std::size_t i = 0; i < currentCycle.size(); ++i) {
+			const value_type point = currentCycle[i];
+			const value_type image = currentCycle[(i + 1) % currentCycle.size()];
+
+			checkPackedPoint(point);
+
+			m_image &= ~(packed_type(0xF) << (4 * point));
+			m_image |= static_cast< packed_type >(image) << (4 * point);
+		}
+	}
+
+	assert(isPackedBijection(m_image));
+}
+
+PackedPermutation::PackedPermutation(const AbstractPermutation &perm)
+	: details::SignedPermutation(perm.sign()), m_image(packImageOf(perm)) {
+}
+
+PackedPermutation::value_type PackedPermutation::maxElement() const {
+	const packed_type movedNibbles = m_image ^ identity_image;
+
+	value_type max = 0;
+	for (std::size_t i = 0; i < max_points; ++i) {
+		if (packedNibble(movedNibbles, i) != 0) {
+			max = static_cast< value_type >(i);
+		}
+	}
+
+	return max;
+}
+
+PackedPermutation::value_type PackedPermutation::image(value_type value) const {
+	return value < max_points ? static_cast< value_type >(packedNibble(m_image, value)) : value;
+}
+
+PackedPermutation::packed_type PackedPermutation::packedImage() const {
+	return m_image;
+}
+
+bool PackedPermutation::isIdentity() const {
+	return sign() > 0 && m_image == identity_image;
+}
+
+void PackedPermutation::invert() {
+	packed_type inverse = 0;
+	for (std::size_t i = 0; i < max_points; ++i) {
+		inverse |= static_cast< packed_type >(i) << (4 * packedNibble(m_image, i));
+	}
+
+	m_image = inverse;
+}
+
+void PackedPermutation::preMultiply(const AbstractPermutation &other) {
+	// Pack the other permutation first, so that this one remains unchanged if it can't be represented
+	const packed_type otherImage = packImageOf(other);
+
+	details::SignedPermutation::preMultiply(other);
+
+	m_image = composePacked(otherImage, m_image);
+}
+
+void PackedPermutation::postMultiply(const AbstractPermutation &other) {
+	// Pack the other permutation first, so that this one remains unchanged if it can't be represented
+	const packed_type otherImage = packImageOf(other);
+
+	details::SignedPermutation::postMultiply(other);
+
+	m_image = composePacked(m_image, otherImage);
+}
+
+bool PackedPermutation::equals(const AbstractPermutation &other) const {
+	if (const PackedPermutation *packed = dynamic_cast< const PackedPermutation * >(&other)) {
+		return sign() == packed->sign() && m_image == packed->m_image;
+	}
+
+	return AbstractPermutation::equals(other);
+}
+
+std::size_t PackedPermutation::hash() const {
+	// Has to be consistent with the hash of other permutation types, so we can't simply hash the packed image
+	value_type image[max_points];
+	for (std::size_t i = 0; i < max_points; ++i) {
+		image[i] = static_cast< value_type >(packedNibble(m_image, i));
+	}
+
+	const std::size_t size = m_image == identity_image ? 0 : maxElement() + 1;
+
+	return details::hashWithSign(details::hashImage(image, size), sign());
+}
+
+Cycle PackedPermutation::toCycle() const {
+	value_type image[max_points];
+	for (std::size_t i = 0; i < max_points; ++i) {
+		image[i] = static_cast< value_type >(packedNibble(m_image, i));
+	}
+
+	return Cycle::fromImage(image, max_points);
+}
+
+void PackedPermutation::shift(int shift, std::size_t startIndex) {
+	const auto shifted = [shift, startIndex](value_type point) {
+		return point >= startIndex ? static_cast< value_type >(static_cast< int >(point) + shift) : point;
+	};
+
+	packed_type shiftedImage = identity_image;
+	for (std::size_t i = 0; i < max_points; ++i) {
+		const value_type image = static_cast< value_type >(packedNibble(m_image, i));
+
+		if (image == i) {
+			continue;
+		}
+
+		const value_type point = shifted(static_cast< value_type >(i));
+		checkPackedPoint(point);
+		checkPackedPoint(shifted(image));
+
+		shiftedImage &= ~(packed_type(0xF) << (4 * point));
+		shiftedImage |= static_cast< packed_type >(shifted(image)) << (4 * point);
+	}
+
+	assert(isPackedBijection(shiftedImage));
+
+	m_image = shiftedImage;
+}
+
+void PackedPermutation::insertIntoStream(std::ostream &stream) const {
+	// Represent this object in disjoint cycle notation
+	stream << (sign() < 0 ? "-" : "+") << toCycle();
+}
+
+} // namespace perm
@@ -0,0 +1,28 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/PermutationGroup.hpp"
+
+namespace perm {
+
+PermutationGroup toPermutationGroup(const AbstractPermutationGroup &group) {
+	switch (group.type()) {
+		case PermutationGroupType::Primitive:
+			return static_cast< const PrimitivePermutationGroup & >(group);
+		case PermutationGroupType::Young:
+			return static_cast< const YoungSubgroup & >(group);
+		case PermutationGroupType::Cyclic:
+			return static_cast< const CyclicGroup & >(group);
+		case PermutationGroupType::Dihedral:
+			return static_cast< const DihedralGroup & >(group);
+		default:
+			break;
+	}
+
+	// Fall back to an explicit representation of the given group
+	return PrimitivePermutationGroup(group.getGenerators());
+}
+
+} // namespace perm
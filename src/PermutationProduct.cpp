@@ -0,0 +1,184 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/PermutationProduct.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <set>
+#include <utility>
+
+namespace perm {
+
+/**
+ * Computes the images of the points 0..maxElement under the product that is described by the given sequence of
+ * factors in a single pass over the points. getFactor maps an entry of the sequence to the corresponding ProductFactor.
+ */
+template< typename Iterator, typename GetFactor >
+static void evaluateProduct(ExplicitPermutation::image_type &image, AbstractPermutation::value_type maxElement,
+							Iterator begin, Iterator end, GetFactor &&getFactor) {
+	image.resize(static_cast< std::size_t >(maxElement) + 1);
+
+	for (AbstractPermutation::value_type i = 0; i <= maxElement; ++i) {
+		AbstractPermutation::value_type current = i;
+
+		for (Iterator it = begin; it != end; ++it) {
+			current = getFactor(*it).apply(current);
+		}
+
+		image[i] = current;
+	}
+
+	// Assert that the product is a bijection
+	assert(std::set< AbstractPermutation::value_type >(image.begin(), image.end()).size() == image.size());
+}
+
+PermutationProduct::PermutationProduct(const AbstractPermutation &factor) {
+	append(factor);
+}
+
+PermutationProduct &PermutationProduct::append(const AbstractPermutation &factor) {
+	m_factors.emplace_back(factor);
+
+	m_maxElement = std::max(m_maxElement, factor.maxElement());
+	m_negative   = m_negative ^ (factor.sign() < 0);
+
+	return *this;
+}
+
+std::size_t PermutationProduct::size() const {
+	return m_factors.size();
+}
+
+bool PermutationProduct::empty() const {
+	return m_factors.empty();
+}
+
+PermutationProduct::value_type PermutationProduct::maxElement() const {
+	return m_maxElement;
+}
+
+PermutationProduct::value_type PermutationProduct::image(value_type value) const {
+	for (const details::ProductFactor &currentFactor : m_factors) {
+		value = currentFactor.apply(value);
+	}
+
+	return value;
+}
+
+int PermutationProduct::sign() const {
+	return m_negative ? -1 : 1;
+}
+
+ExplicitPermutation PermutationProduct::materialize() const {
+	ExplicitPermutation result;
+
+	materializeInto(result);
+
+	return result;
+}
+
+void PermutationProduct::materializeInto(ExplicitPermutation &destination) const {
+	assert(std::none_of(m_factors.begin(), m_factors.end(),
+						[&destination](const details::ProductFactor &factor) { return factor.perm == &destination; }));
+
+	evaluateProduct(destination.m_image, m_maxElement, m_factors.begin(), m_factors.end(),
+					[](const details::ProductFactor &factor) -> const details::ProductFactor & { return factor; });
+
+	destination.setSign(sign());
+
+	destination.reduceImageRepresentation();
+}
+
+PermutationProduct operator*(const PermutationProduct &lhs, const AbstractPermutation &rhs) {
+	PermutationProduct result(lhs);
+
+	result.append(rhs);
+
+	return result;
+}
+
+PermutationProduct operator*(PermutationProduct &&lhs, const AbstractPermutation &rhs) {
+	// Reuse the memory of the temporary
+	PermutationProduct result(std::move(lhs));
+
+	result.append(rhs);
+
+	return result;
+}
+
+PermutationWord::PermutationWord(const std::vector< Permutation > &generators, std::vector< std::size_t > letters) {
+	m_generators.reserve(generators.size());
+	for (const Permutation &currentGenerator : generators) {
+		m_generators.emplace_back(currentGenerator.get());
+	}
+
+	m_letters.reserve(letters.size());
+	for (std::size_t currentLetter : letters) {
+		append(currentLetter);
+	}
+}
+
+PermutationWord &PermutationWord::append(std::size_t generatorIndex) {
+	assert(generatorIndex < m_generators.size());
+
+	const AbstractPermutation &generator = *m_generators[generatorIndex].perm;
+
+	m_letters.push_back(generatorIndex);
+	m_maxElement = std::max(m_maxElement, generator.maxElement());
+	m_negative   = m_negative ^ (generator.sign() < 0);
+
+	return *this;
+}
+
+const std::vector< std::size_t > &PermutationWord::letters() const {
+	return m_letters;
+}
+
+std::size_t PermutationWord::size() const {
+	return m_letters.size();
+}
+
+bool PermutationWord::empty() const {
+	return m_letters.empty();
+}
+
+PermutationWord::value_type PermutationWord::maxElement() const {
+	return m_maxElement;
+}
+
+PermutationWord::value_type PermutationWord::image(value_type value) const {
+	for (std::size_t currentLetter : m_letters) {
+		value = m_generators[currentLetter].apply(value);
+	}
+
+	return value;
+}
+
+int PermutationWord::sign() const {
+	return m_negative ? -1 : 1;
+}
+
+ExplicitPermutation PermutationWord::materialize() const {
+	ExplicitPermutation result;
+
+	materializeInto(result);
+
+	return result;
+}
+
+void PermutationWord::materializeInto(ExplicitPermutation &destination) const {
+	assert(std::none_of(m_generators.begin(), m_generators.end(),
+						[&destination](const details::ProductFactor &factor) { return factor.perm == &destination; }));
+
+	evaluateProduct(destination.m_image, m_maxElement, m_letters.begin(), m_letters.end(),
+					[this](std::size_t letter) -> const details::ProductFactor & { return m_generators[letter]; });
+
+	destination.setSign(sign());
+
+	destination.reduceImageRepresentation();
+}
+
+} // namespace perm
@@ -0,0 +1,135 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/PermutationView.hpp"
+#include "libperm/details/Hash.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace perm {
+
+namespace details {
+
+	PermutationViewBase::PermutationViewBase(const value_type *image, std::size_t size, int sign)
+		: AbstractPermutation(), m_image(image), m_size(size), m_negative(sign < 0) {
+		assert(sign == -1 || sign == 1);
+		assert(image != nullptr || size == 0);
+		// Assert that the image contains all points in [0, n) where n = size
+		assert(std::accumulate(image, image + size, static_cast< std::size_t >(0)) == size * (size - 1) / 2);
+
+		// Trailing fixed points are irrelevant. Skipping them here makes maxElement() consistent with the other
+		// permutation implementations.
+		while (m_size > 0 && m_image[m_size - 1] == m_size - 1) {
+			--m_size;
+		}
+	}
+
+	PermutationViewBase::value_type PermutationViewBase::maxElement() const {
+		return m_size > 0 ? static_cast< value_type >(m_size - 1) : 0;
+	}
+
+	int PermutationViewBase::sign() const {
+		return m_negative ? -1 : 1;
+	}
+
+	void PermutationViewBase::setSign(int sign) {
+		m_negative = sign < 0;
+	}
+
+	void PermutationViewBase::invert() {
+		throw std::logic_error("Permutation views are read-only");
+	}
+
+	void PermutationViewBase::preMultiply(const AbstractPermutation &other) {
+		(void) other;
+		throw std::logic_error("Permutation views are read-only");
+	}
+
+	void PermutationViewBase::postMultiply(const AbstractPermutation &other) {
+		(void) other;
+		throw std::logic_error("Permutation views are read-only");
+	}
+
+	void PermutationViewBase::shift(int shift, std::size_t startIndex) {
+		(void) shift;
+		(void) startIndex;
+		throw std::logic_error("Permutation views are read-only");
+	}
+
+	void PermutationViewBase::insertIntoStream(std::ostream &stream) const {
+		// Represent this object in disjoint cycle notation
+		stream << (sign() < 0 ? "-" : "+") << toCycle();
+	}
+
+} // namespace details
+
+PermutationView::PermutationView(const value_type *image, std::size_t size, int sign)
+	: details::PermutationViewBase(image, size, sign) {
+}
+
+PermutationView::PermutationView(const std::vector< value_type > &image, int sign)
+	: PermutationView(image.data(), image.size(), sign) {
+}
+
+PermutationView::value_type PermutationView::image(value_type value) const {
+	return value < m_size ? m_image[value] : value;
+}
+
+const PermutationView::value_type *PermutationView::contiguousImage() const {
+	// The identity has no (non-trivial) images that could be referred to
+	return m_size > 0 ? m_image : nullptr;
+}
+
+std::size_t PermutationView::hash() const {
+	// Consistent with AbstractPermutation::hash, as m_size doesn't include trailing fixed points
+	return details::hashWithSign(details::hashImage(m_image, m_size), sign());
+}
+
+Cycle PermutationView::toCycle() const {
+	return Cycle::fromImage(m_image, m_size);
+}
+
+InversePermutationView::InversePermutationView(const value_type *image, std::size_t size, int sign)
+	: details::PermutationViewBase(image, size, sign) {
+}
+
+InversePermutationView::InversePermutationView(const std::vector< value_type > &image, int sign)
+	: InversePermutationView(image.data(), image.size(), sign) {
+}
+
+InversePermutationView::value_type InversePermutationView::image(value_type value) const {
+	if (value >= m_size) {
+		return value;
+	}
+
+	// The image of value under the inverse is the point that is mapped to value
+	const value_type *preImage = std::find(m_image, m_image + m_size, value);
+	assert(preImage != m_image + m_size);
+
+	return static_cast< value_type >(preImage - m_image);
+}
+
+Cycle InversePermutationView::toCycle() const {
+	// The cycles of the inverse are the reversed cycles of the viewed permutation
+	const Cycle cycle = Cycle::fromImage(m_image, m_size);
+
+	std::vector< std::vector< Cycle::value_type > > reversedCycles;
+	reversedCycles.reserve(cycle.size());
+
+	for (const Cycle::Span currentCycle : cycle) {
+		reversedCycles.emplace_back(std::make_reverse_iterator(currentCycle.end()),
+									std::make_reverse_iterator(currentCycle.begin()));
+	}
+
+	return Cycle(std::move(reversedCycles));
+}
+
+} // namespace perm
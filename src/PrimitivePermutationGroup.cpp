@@ -7,10 +7,16 @@
 #include "libperm/AbstractPermutation.hpp"
 #include "libperm/DiminoAlgorithm.hpp"
 #include "libperm/ExplicitPermutation.hpp"
+#include "libperm/details/Parallel.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <utility>
 
 namespace perm {
 
@@ -18,20 +24,267 @@ PrimitivePermutationGroup::PrimitivePermutationGroup() : AbstractPermutationGrou
 	setGenerators({});
 }
 
+PrimitivePermutationGroup::PrimitivePermutationGroup(pmr::memory_resource *resource)
+	: AbstractPermutationGroup(PermutationGroupType::Primitive), m_resource(resource) {
+	assert(resource != nullptr);
+
+	setGenerators({});
+}
+
 PrimitivePermutationGroup::PrimitivePermutationGroup(std::vector< Permutation > generators)
 	: AbstractPermutationGroup(PermutationGroupType::Primitive) {
 	setGenerators(std::move(generators));
 }
 
+PrimitivePermutationGroup::PrimitivePermutationGroup(std::vector< Permutation > generators,
+													 pmr::memory_resource *resource)
+	: AbstractPermutationGroup(PermutationGroupType::Primitive), m_resource(resource) {
+	assert(resource != nullptr);
+
+	setGenerators(std::move(generators));
+}
+
+PrimitivePermutationGroup::PrimitivePermutationGroup(const PrimitivePermutationGroup &other)
+	: AbstractPermutationGroup(other) {
+	std::lock_guard< std::mutex > guard(other.m_materializationMutex);
+
+	m_generators         = other.m_generators;
+	m_elements           = other.m_elements;
+	m_includedGenerators = other.m_includedGenerators;
+	m_materialized       = other.m_materialized.load();
+	m_resource           = other.m_resource;
+	m_threadCount        = other.m_threadCount;
+	m_sortedIndices      = other.m_sortedIndices;
+	m_generatorTable     = other.m_generatorTable;
+	m_cayleyTable        = other.m_cayleyTable;
+}
+
+PrimitivePermutationGroup::PrimitivePermutationGroup(PrimitivePermutationGroup &&other)
+	: AbstractPermutationGroup(other) {
+	std::lock_guard< std::mutex > guard(other.m_materializationMutex);
+
+	m_generators         = std::move(other.m_generators);
+	m_elements           = std::move(other.m_elements);
+	m_includedGenerators = other.m_includedGenerators;
+	m_materialized       = other.m_materialized.load();
+	m_resource           = other.m_resource;
+	m_threadCount        = other.m_threadCount;
+	m_sortedIndices      = other.m_sortedIndices;
+	m_generatorTable     = other.m_generatorTable;
+	m_cayleyTable        = other.m_cayleyTable;
+
+	// Leave other in a valid state
+	other.setGenerators({});
+}
+
+PrimitivePermutationGroup &PrimitivePermutationGroup::operator=(const PrimitivePermutationGroup &other) {
+	if (this != &other) {
+		std::scoped_lock guard(m_materializationMutex, other.m_materializationMutex);
+
+		m_generators         = other.m_generators;
+		m_elements           = other.m_elements;
+		m_includedGenerators = other.m_includedGenerators;
+		m_materialized       = other.m_materialized.load();
+		m_resource           = other.m_resource;
+		m_threadCount        = other.m_threadCount;
+		m_sortedIndices      = other.m_sortedIndices;
+		m_generatorTable     = other.m_generatorTable;
+		m_cayleyTable        = other.m_cayleyTable;
+	}
+
+	return *this;
+}
+
+PrimitivePermutationGroup &PrimitivePermutationGroup::operator=(PrimitivePermutationGroup &&other) {
+	if (this != &other) {
+		std::scoped_lock guard(m_materializationMutex, other.m_materializationMutex);
+
+		m_generators         = std::move(other.m_generators);
+		m_elements           = std::move(other.m_elements);
+		m_includedGenerators = other.m_includedGenerators;
+		m_materialized       = other.m_materialized.load();
+		m_resource           = other.m_resource;
+		m_threadCount        = other.m_threadCount;
+		m_sortedIndices      = other.m_sortedIndices;
+		m_generatorTable     = other.m_generatorTable;
+		m_cayleyTable        = other.m_cayleyTable;
+
+		// Leave other in a valid state
+		other.setGenerators({});
+	}
+
+	return *this;
+}
+
+void PrimitivePermutationGroup::setThreadCount(std::size_t threadCount) {
+	m_threadCount = threadCount;
+}
+
+std::size_t PrimitivePermutationGroup::threadCount() const {
+	return m_threadCount;
+}
+
+pmr::memory_resource *PrimitivePermutationGroup::resource() const {
+	return m_resource;
+}
+
+void PrimitivePermutationGroup::shift(int shift, std::size_t startIndex) {
+	for (Permutation &currentGenerator : m_generators) {
+		currentGenerator->shift(shift, startIndex);
+	}
+
+	for (Permutation &currentElement : mutableElements()) {
+		currentElement->shift(shift, startIndex);
+	}
+}
+
+void PrimitivePermutationGroup::conjugate(const AbstractPermutation &perm) {
+	if (perm.isIdentity()) {
+		return;
+	}
+
+	ExplicitPermutation::image_type inverseImage(perm.maxElement() + 1);
+	for (AbstractPermutation::value_type i = 0; i <= perm.maxElement(); ++i) {
+		inverseImage[perm.image(i)] = i;
+	}
+
+	const ExplicitPermutation inverse(std::move(inverseImage), perm.sign());
+
+	// The signs of perm and its inverse cancel, so the signs of the elements remain unchanged
+	for (Permutation &currentGenerator : m_generators) {
+		currentGenerator->preMultiply(inverse);
+		currentGenerator->postMultiply(perm);
+	}
+
+	for (Permutation &currentElement : mutableElements()) {
+		currentElement->preMultiply(inverse);
+		currentElement->postMultiply(perm);
+	}
+}
+
+void PrimitivePermutationGroup::removeFixedPoints(std::vector< AbstractPermutation::value_type > points) {
+	// Remove the biggest points first, so that the remaining points keep their labels in the meantime
+	std::sort(points.begin(), points.end(), std::greater<>{});
+	points.erase(std::unique(points.begin(), points.end()), points.end());
+
+	for (Permutation &currentGenerator : m_generators) {
+		for (AbstractPermutation::value_type currentPoint : points) {
+			assert(currentGenerator->image(currentPoint) == currentPoint);
+
+			currentGenerator->shift(-1, currentPoint);
+		}
+	}
+
+	for (Permutation &currentElement : mutableElements()) {
+		for (AbstractPermutation::value_type currentPoint : points) {
+			currentElement->shift(-1, currentPoint);
+		}
+	}
+}
+
+/**
+ * @returns Whether the two given generator sets act on disjoint sets of points
+ */
+[[maybe_unused]] static bool haveDisjointSupport(const std::vector< Permutation > &lhs,
+												 const std::vector< Permutation > &rhs) {
+	for (const Permutation &currentLhs : lhs) {
+		for (AbstractPermutation::value_type i = 0; i <= currentLhs->maxElement(); ++i) {
+			if (currentLhs->image(i) == i) {
+				continue;
+			}
+
+			for (const Permutation &currentRhs : rhs) {
+				if (currentRhs->image(i) != i) {
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+PrimitivePermutationGroup PrimitivePermutationGroup::directProduct(const PrimitivePermutationGroup &lhs,
+																   const PrimitivePermutationGroup &rhs,
+																   std::size_t threadCount) {
+	assert(haveDisjointSupport(lhs.m_generators, rhs.m_generators));
+
+	PrimitivePermutationGroup product(lhs.m_resource);
+
+	product.m_generators.clear();
+	for (const std::vector< Permutation > *currentGenerators : { &lhs.m_generators, &rhs.m_generators }) {
+		for (const Permutation &currentGenerator : *currentGenerators) {
+			if (!currentGenerator->isIdentity()) {
+				product.m_generators.push_back(currentGenerator);
+			}
+		}
+	}
+
+	if (product.m_generators.empty()) {
+		product.m_generators.emplace_back(ExplicitPermutation());
+	}
+
+	// Since the supports are disjoint, every element of the product can be written as a product of an element of lhs
+	// and an element of rhs, which is unique up to the sign: if both groups contain the negative identity, a * b is the
+	// same as (-a) * (-b). In that case, restricting the rhs elements to those with a positive sign makes the
+	// decomposition unique. Either way, all elements can be written to their final position right away.
+	const std::vector< Permutation > &lhsElements = lhs.elements();
+
+	const bool sharedNegativeIdentity =
+		lhs.contains(ExplicitPermutation(-1)) && rhs.contains(ExplicitPermutation(-1));
+
+	std::vector< const AbstractPermutation * > rhsElements;
+	for (const Permutation &currentElement : rhs.elements()) {
+		if (!sharedNegativeIdentity || currentElement->sign() > 0) {
+			rhsElements.push_back(&currentElement.get());
+		}
+	}
+	const std::size_t rhsOrder = rhsElements.size();
+
+	std::vector< Permutation > &productElements = product.mutableElements();
+	productElements.reserve(lhsElements.size() * rhsOrder);
+	for (std::size_t i = 0; i < lhsElements.size() * rhsOrder; ++i) {
+		productElements.emplace_back(ExplicitPermutation(product.m_resource));
+	}
+
+	details::parallelFor(0, productElements.size(), threadCount, [&](std::size_t begin, std::size_t end) {
+		for (std::size_t i = begin; i < end; ++i) {
+			composeInto(static_cast< ExplicitPermutation & >(productElements[i].get()), lhsElements[i / rhsOrder].get(),
+						*rhsElements[i % rhsOrder]);
+		}
+	});
+
+	product.m_includedGenerators = product.m_generators.size();
+	product.m_materialized       = true;
+
+	return product;
+}
+
 std::vector< AbstractPermutation::value_type >
 	PrimitivePermutationGroup::orbit(AbstractPermutation::value_type point) const {
-	std::vector< AbstractPermutation::value_type > orbit;
+	AbstractPermutation::value_type degree = 0;
+	for (const Permutation &currentGenerator : m_generators) {
+		degree = std::max(degree, currentGenerator->maxElement() + 1);
+	}
 
-	for (const Permutation &current : m_elements) {
-		AbstractPermutation::value_type image = current->image(point);
+	if (point >= degree) {
+		return { point };
+	}
+
+	// As the group is finite, the orbit consists of all points that are reachable from the given one by repeatedly
+	// applying generators. Thus, it can be found by a breadth-first search, which doesn't require the group's elements.
+	std::vector< bool > visited(degree, false);
+	std::vector< AbstractPermutation::value_type > orbit = { point };
+	visited[point]                                       = true;
+
+	for (std::size_t i = 0; i < orbit.size(); ++i) {
+		for (const Permutation &currentGenerator : m_generators) {
+			const AbstractPermutation::value_type image = currentGenerator->image(orbit[i]);
 
-		if (std::find(orbit.begin(), orbit.end(), image) == orbit.end()) {
-			orbit.push_back(std::move(image));
+			if (!visited[image]) {
+				visited[image] = true;
+				orbit.push_back(image);
+			}
 		}
 	}
 
@@ -39,21 +292,43 @@ std::vector< AbstractPermutation::value_type >
 }
 
 std::size_t PrimitivePermutationGroup::order() const {
-	return m_elements.size();
+	return elements().size();
 }
 
 bool PrimitivePermutationGroup::contains(const AbstractPermutation &perm) const {
 	// TODO: Improve speed of lookup by e.g. keeping elements sorted
-	return std::find(m_elements.begin(), m_elements.end(), perm) != m_elements.end();
+	const std::vector< Permutation > &groupElements = elements();
+
+	return std::find(groupElements.begin(), groupElements.end(), perm) != groupElements.end();
 }
 
 bool PrimitivePermutationGroup::addGenerator(Permutation perm) {
-	if (!contains(perm.get())) {
-		m_generators.push_back(std::move(perm));
-		return DiminoAlgorithm::extendGroup(m_elements, m_generators, m_generators.size() - 1);
-	} else {
+	// Checking whether the generator is redundant requires the elements (which incorporates all pending generators)
+	if (contains(perm.get())) {
 		return false;
 	}
+
+	m_generators.push_back(std::move(perm));
+	m_includedGenerators = m_generators.size();
+
+	return DiminoAlgorithm::extendGroup(mutableElements(), m_generators, m_generators.size() - 1, m_threadCount,
+										m_resource);
+}
+
+void PrimitivePermutationGroup::addGenerators(std::vector< Permutation > generators) {
+	for (Permutation &currentGenerator : generators) {
+		if (currentGenerator->isIdentity()
+			|| std::find(m_generators.begin(), m_generators.end(), currentGenerator) != m_generators.end()) {
+			continue;
+		}
+
+		m_generators.push_back(std::move(currentGenerator));
+	}
+
+	if (m_includedGenerators < m_generators.size()) {
+		// Defer the extension of the group until its elements are actually needed
+		m_materialized = false;
+	}
 }
 
 void PrimitivePermutationGroup::setGenerators(std::vector< Permutation > generators) {
@@ -64,7 +339,11 @@ void PrimitivePermutationGroup::setGenerators(std::vector< Permutation > generat
 		m_generators.emplace_back(ExplicitPermutation());
 	}
 
-	regenerateGroup();
+	m_elements.reset();
+	m_includedGenerators = 0;
+	m_materialized       = false;
+
+	resetTables();
 }
 
 const std::vector< Permutation > &PrimitivePermutationGroup::getGenerators() const {
@@ -72,26 +351,39 @@ const std::vector< Permutation > &PrimitivePermutationGroup::getGenerators() con
 }
 
 void PrimitivePermutationGroup::getElementsTo(std::vector< Permutation > &permutations) const {
+	const std::vector< Permutation > &groupElements = elements();
+
 	permutations.clear();
-	permutations.reserve(m_elements.size());
+	permutations.reserve(groupElements.size());
 
-	for (const Permutation &current : m_elements) {
+	for (const Permutation &current : groupElements) {
 		permutations.push_back(current);
 	}
 }
 
+std::size_t PrimitivePermutationGroup::rank(const AbstractPermutation &perm) const {
+	return indexOf(perm);
+}
+
+Permutation PrimitivePermutationGroup::unrank(std::size_t rank) const {
+	return element(rank);
+}
+
 enum class Coset { Left, Right };
 
 template< Coset cosetType >
-std::vector< Permutation > computeCoset(const AbstractPermutation &perm, const std::vector< Permutation > &elements) {
+std::vector< Permutation > computeCoset(const AbstractPermutation &perm, const std::vector< Permutation > &elements,
+										pmr::memory_resource *resource) {
 	std::vector< Permutation > coset;
 	coset.reserve(elements.size());
 
-	for (Permutation currentElement : elements) {
+	for (const Permutation &element : elements) {
+		ExplicitPermutation currentElement(element.get(), resource);
+
 		if constexpr (cosetType == Coset::Left) {
-			currentElement->preMultiply(perm);
+			currentElement.preMultiply(perm);
 		} else {
-			currentElement->postMultiply(perm);
+			currentElement.postMultiply(perm);
 		}
 
 		coset.push_back(std::move(currentElement));
@@ -101,15 +393,225 @@ std::vector< Permutation > computeCoset(const AbstractPermutation &perm, const s
 }
 
 std::vector< Permutation > PrimitivePermutationGroup::leftCoset(const AbstractPermutation &perm) const {
-	return computeCoset< Coset::Left >(perm, m_elements);
+	return computeCoset< Coset::Left >(perm, elements(), m_resource);
 }
 
 std::vector< Permutation > PrimitivePermutationGroup::rightCoset(const AbstractPermutation &perm) const {
-	return computeCoset< Coset::Right >(perm, m_elements);
+	return computeCoset< Coset::Right >(perm, elements(), m_resource);
+}
+
+void PrimitivePermutationGroup::materialize() const {
+	if (m_materialized) {
+		return;
+	}
+
+	std::lock_guard< std::mutex > guard(m_materializationMutex);
+
+	if (m_materialized) {
+		// Another thread has materialized the elements in the meantime
+		return;
+	}
+
+	if (m_includedGenerators == 0) {
+		m_elements = std::make_shared< std::vector< Permutation > >(
+			DiminoAlgorithm::generateGroupElements(m_generators, m_threadCount, m_resource));
+	} else {
+		// Only extend the group by the generators that have been added since the elements have last been generated
+		std::vector< Permutation > &groupElements = mutableElements();
+
+		for (std::size_t i = m_includedGenerators; i < m_generators.size(); ++i) {
+			DiminoAlgorithm::extendGroup(groupElements, m_generators, i, m_threadCount, m_resource);
+		}
+	}
+
+	m_includedGenerators = m_generators.size();
+	m_materialized       = true;
+
+	resetTables();
+}
+
+const std::vector< Permutation > &PrimitivePermutationGroup::elements() const {
+	materialize();
+
+	assert(m_elements);
+
+	return *m_elements;
+}
+
+std::vector< Permutation > &PrimitivePermutationGroup::mutableElements() const {
+	resetTables();
+
+	if (!m_elements) {
+		m_elements = std::make_shared< std::vector< Permutation > >();
+	} else if (m_elements.use_count() > 1) {
+		// Detach from the storage shared with other groups
+		auto detached = std::make_shared< std::vector< Permutation > >();
+		detached->reserve(m_elements->size());
+
+		for (const Permutation &currentElement : *m_elements) {
+			detached->emplace_back(ExplicitPermutation(currentElement.get(), m_resource));
+		}
+
+		m_elements = std::move(detached);
+	}
+
+	return *m_elements;
+}
+
+void PrimitivePermutationGroup::resetTables() const {
+	m_sortedIndices.reset();
+	m_generatorTable.reset();
+	m_cayleyTable.reset();
+}
+
+const std::vector< MultiplicationTable::index_type > &PrimitivePermutationGroup::sortedIndices() const {
+	if (!m_sortedIndices) {
+		assert(m_elements);
+		const std::vector< Permutation > &groupElements = *m_elements;
+
+		auto indices = std::make_shared< std::vector< MultiplicationTable::index_type > >(groupElements.size());
+		std::iota(indices->begin(), indices->end(), 0);
+		std::sort(indices->begin(), indices->end(),
+				  [&groupElements](MultiplicationTable::index_type lhs, MultiplicationTable::index_type rhs) {
+					  return compare(groupElements[lhs].get(), groupElements[rhs].get()) < 0;
+				  });
+
+		m_sortedIndices = std::move(indices);
+	}
+
+	return *m_sortedIndices;
+}
+
+/**
+ * @returns The index of the given permutation in the given list of elements (or the list's size, if it is not
+ * contained), using the given indices of the elements sorted by element
+ */
+static std::size_t lookupElementIndex(const std::vector< Permutation > &elements,
+									  const std::vector< MultiplicationTable::index_type > &sortedIndices,
+									  const AbstractPermutation &perm) {
+	auto it = std::lower_bound(sortedIndices.begin(), sortedIndices.end(), perm,
+							   [&elements](MultiplicationTable::index_type index, const AbstractPermutation &value) {
+								   return compare(elements[index].get(), value) < 0;
+							   });
+
+	if (it != sortedIndices.end() && elements[*it].get() == perm) {
+		return *it;
+	}
+
+	return elements.size();
+}
+
+const Permutation &PrimitivePermutationGroup::element(std::size_t index) const {
+	const std::vector< Permutation > &groupElements = elements();
+
+	assert(index < groupElements.size());
+
+	return groupElements[index];
 }
 
-void PrimitivePermutationGroup::regenerateGroup() {
-	m_elements = DiminoAlgorithm::generateGroupElements(m_generators);
+std::size_t PrimitivePermutationGroup::indexOf(const AbstractPermutation &perm) const {
+	const std::vector< Permutation > &groupElements = elements();
+
+	std::shared_ptr< const std::vector< MultiplicationTable::index_type > > indices;
+	{
+		std::lock_guard< std::mutex > guard(m_materializationMutex);
+
+		sortedIndices();
+		indices = m_sortedIndices;
+	}
+
+	return lookupElementIndex(groupElements, *indices, perm);
+}
+
+const MultiplicationTable &PrimitivePermutationGroup::generatorTable(std::size_t threadCount) const {
+	const std::vector< Permutation > &groupElements = elements();
+
+	std::lock_guard< std::mutex > guard(m_materializationMutex);
+
+	if (!m_generatorTable) {
+		const std::vector< MultiplicationTable::index_type > &indices = sortedIndices();
+
+		auto table = std::make_shared< MultiplicationTable >(groupElements.size(), m_generators.size());
+
+		details::parallelFor(0, groupElements.size(), threadCount, [&](std::size_t begin, std::size_t end) {
+			ExplicitPermutation product(m_resource);
+
+			for (std::size_t i = begin; i < end; ++i) {
+				for (std::size_t k = 0; k < m_generators.size(); ++k) {
+					composeInto(product, groupElements[i].get(), m_generators[k].get());
+
+					const std::size_t productIndex = lookupElementIndex(groupElements, indices, product);
+					assert(productIndex < groupElements.size());
+
+					(*table)(i, k) = static_cast< MultiplicationTable::index_type >(productIndex);
+				}
+			}
+		});
+
+		m_generatorTable = std::move(table);
+	}
+
+	return *m_generatorTable;
+}
+
+const MultiplicationTable &PrimitivePermutationGroup::cayleyTable(std::size_t threadCount) const {
+	const MultiplicationTable &generators = generatorTable(threadCount);
+	const std::size_t identityIndex       = indexOf(ExplicitPermutation());
+	const std::size_t groupOrder          = generators.rows();
+
+	assert(identityIndex < groupOrder);
+
+	std::lock_guard< std::mutex > guard(m_materializationMutex);
+
+	if (!m_cayleyTable) {
+		// Walk through the group by successively multiplying with generators, starting at the identity. This expresses
+		// every element g_j as a product g_p * s_k of an element that has been reached before and a generator. Then
+		// g_i * g_j = (g_i * g_p) * s_k, so that every column can be obtained from a previous one by a lookup in the
+		// generator table.
+		std::vector< MultiplicationTable::index_type > reachedOrder;
+		std::vector< MultiplicationTable::index_type > parents(groupOrder);
+		std::vector< MultiplicationTable::index_type > generatorIndices(groupOrder);
+		std::vector< bool > reached(groupOrder, false);
+
+		reachedOrder.reserve(groupOrder);
+		reachedOrder.push_back(static_cast< MultiplicationTable::index_type >(identityIndex));
+		reached[identityIndex] = true;
+
+		for (std::size_t pos = 0; pos < reachedOrder.size(); ++pos) {
+			const MultiplicationTable::index_type current = reachedOrder[pos];
+
+			for (std::size_t k = 0; k < generators.columns(); ++k) {
+				const MultiplicationTable::index_type next = generators(current, k);
+
+				if (!reached[next]) {
+					reached[next]          = true;
+					parents[next]          = current;
+					generatorIndices[next] = static_cast< MultiplicationTable::index_type >(k);
+					reachedOrder.push_back(next);
+				}
+			}
+		}
+
+		assert(reachedOrder.size() == groupOrder);
+
+		auto table = std::make_shared< MultiplicationTable >(groupOrder, groupOrder);
+
+		details::parallelFor(0, groupOrder, threadCount, [&](std::size_t begin, std::size_t end) {
+			for (std::size_t i = begin; i < end; ++i) {
+				(*table)(i, identityIndex) = static_cast< MultiplicationTable::index_type >(i);
+
+				for (std::size_t pos = 1; pos < reachedOrder.size(); ++pos) {
+					const MultiplicationTable::index_type j = reachedOrder[pos];
+
+					(*table)(i, j) = generators((*table)(i, parents[j]), generatorIndices[j]);
+				}
+			}
+		});
+
+		m_cayleyTable = std::move(table);
+	}
+
+	return *m_cayleyTable;
 }
 
 std::ostream &operator<<(std::ostream &stream, const PrimitivePermutationGroup &group) {
@@ -125,62 +627,34 @@ std::ostream &operator<<(std::ostream &stream, const PrimitivePermutationGroup &
 	return stream << "}";
 }
 
-struct Canonicalizer {
-	bool operator()(const Permutation &lhs, const Permutation &rhs) const {
-		/*
-		 * The idea used to establish an order between the different permutation elements (required for a minimum
-		 * element to exist) consists in defining a set B that contains all numbers between 0 and n (the elements the
-		 * given permutation objects act on) in a defined order. This can then be used to establish an order between two
-		 * image points: a < b, if a comes before b in B (going left-to-right). Thus, sets of numbers can be ordered: A
-		 * < B, if for the first element (a,b) in which they differ a < b. Now permutations are ordered by taking the
-		 * pointwise image B^g into account, which is defined as {b^g | b in B} and ^ means applying the permutation to
-		 * the respective object. Thus: p1 < p2, if B^p1 < B^p2
-		 *
-		 * Since we don't have any reason to choose B otherwise, we can simply take it as the numbers 0, 1, ..., n in
-		 * ascending order. Therefore, we can simply compare two images numerically to determine if one comes before the
-		 * other in B.
-		 */
-		const AbstractPermutation::value_type n = std::max(lhs->maxElement(), rhs->maxElement());
-
-		for (AbstractPermutation::value_type i = 0; i <= n; ++i) {
-			AbstractPermutation::value_type lhsImage = lhs->image(i);
-			AbstractPermutation::value_type rhsImage = rhs->image(i);
-			if (lhsImage != rhsImage) {
-				return lhsImage < rhsImage;
-			}
-		}
-
-		// Permutations are identical (this is something that we don't expect to happen as the elements passed
-		// in should represent a group and therefore there should be no duplicates.
-		assert(false);
-		return false;
-	}
-};
-
 Permutation PrimitivePermutationGroup::leftCosetRepresentative(const AbstractPermutation &perm) const {
-	assert(!m_elements.empty());
+	const std::vector< Permutation > &groupElements = elements();
+
+	assert(!groupElements.empty());
 
 	if (perm.isIdentity() || contains(perm)) {
 		// If perm is contained in this group (which is guaranteed, if perm == identity), the resulting coset
 		// will just be the group itself, so there is no point in explicitly calculating the coset.
-		return *std::min_element(m_elements.begin(), m_elements.end(), Canonicalizer{});
+		return *std::min_element(groupElements.begin(), groupElements.end());
 	}
 
-	std::vector< Permutation > coset = computeCoset< Coset::Left >(perm, m_elements);
-	return *std::min_element(coset.begin(), coset.end(), Canonicalizer{});
+	std::vector< Permutation > coset = computeCoset< Coset::Left >(perm, groupElements, m_resource);
+	return *std::min_element(coset.begin(), coset.end());
 }
 
 Permutation PrimitivePermutationGroup::rightCosetRepresentative(const AbstractPermutation &perm) const {
-	assert(!m_elements.empty());
+	const std::vector< Permutation > &groupElements = elements();
+
+	assert(!groupElements.empty());
 
 	if (perm.isIdentity() || contains(perm)) {
 		// If perm is contained in this group (which is guaranteed, if perm == identity), the resulting coset
 		// will just be the group itself, so there is no point in explicitly calculating the coset.
-		return *std::min_element(m_elements.begin(), m_elements.end(), Canonicalizer{});
+		return *std::min_element(groupElements.begin(), groupElements.end());
 	}
 
-	std::vector< Permutation > coset = computeCoset< Coset::Right >(perm, m_elements);
-	return *std::min_element(coset.begin(), coset.end(), Canonicalizer{});
+	std::vector< Permutation > coset = computeCoset< Coset::Right >(perm, groupElements, m_resource);
+	return *std::min_element(coset.begin(), coset.end());
 }
 
 } // namespace perm
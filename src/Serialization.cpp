@@ -0,0 +1,159 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/Serialization.hpp"
+
+#include <limits>
+#include <utility>
+
+namespace perm {
+
+static void writeVarint(std::uint64_t value, std::vector< std::uint8_t > &buffer) {
+	while (value >= 0x80) {
+		buffer.push_back(static_cast< std::uint8_t >(value | 0x80));
+		value >>= 7;
+	}
+
+	buffer.push_back(static_cast< std::uint8_t >(value));
+}
+
+static bool readVarint(const std::uint8_t *data, std::size_t size, std::size_t &offset, std::uint64_t &value) {
+	// Fast path for the (by far) most common case of single-byte values
+	if (offset < size && data[offset] < 0x80) {
+		value = data[offset++];
+
+		return true;
+	}
+
+	std::uint64_t result = 0;
+
+	for (unsigned int shift = 0; offset < size && shift < 64; shift += 7) {
+		const std::uint8_t current = data[offset++];
+
+		result |= static_cast< std::uint64_t >(current & 0x7f) << shift;
+
+		if (!(current & 0x80)) {
+			value = result;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Reads the image and the sign of a single permutation. The given flags are used as scratch space for checking that
+ * the read image actually describes a permutation (they are expected to be all false and are left in that state).
+ */
+static bool readPermutation(const std::uint8_t *data, std::size_t size, std::size_t &offset,
+							ExplicitPermutation::image_type &image, int &sign,
+							std::vector< bool > &seen) {
+	std::uint64_t header;
+	if (!readVarint(data, size, offset, header)) {
+		return false;
+	}
+
+	const std::uint64_t n = header >> 1;
+	sign                  = (header & 1) ? -1 : 1;
+
+	// Every image takes up at least one byte. Checking this before allocating anything protects against corrupted
+	// sizes.
+	if (n > size - offset || n > std::numeric_limits< AbstractPermutation::value_type >::max()) {
+		return false;
+	}
+
+	image.resize(static_cast< std::size_t >(n));
+	if (seen.size() < n) {
+		seen.resize(static_cast< std::size_t >(n), false);
+	}
+
+	bool valid = true;
+	for (std::size_t i = 0; i < n && valid; ++i) {
+		std::uint64_t current;
+		valid = readVarint(data, size, offset, current) && current < n && !seen[current];
+
+		if (valid) {
+			image[i]      = static_cast< AbstractPermutation::value_type >(current);
+			seen[current] = true;
+		}
+	}
+
+	for (std::size_t i = 0; i < n; ++i) {
+		seen[i] = false;
+	}
+
+	return valid;
+}
+
+void serialize(const AbstractPermutation &perm, std::vector< std::uint8_t > &buffer) {
+	AbstractPermutation::value_type n = perm.maxElement() + 1;
+	while (n > 0 && perm.image(n - 1) == n - 1) {
+		--n;
+	}
+
+	writeVarint((static_cast< std::uint64_t >(n) << 1) | (perm.sign() < 0 ? 1 : 0), buffer);
+
+	for (AbstractPermutation::value_type i = 0; i < n; ++i) {
+		writeVarint(perm.image(i), buffer);
+	}
+}
+
+void serialize(const std::vector< Permutation > &perms, std::vector< std::uint8_t > &buffer) {
+	writeVarint(perms.size(), buffer);
+
+	for (const Permutation &currentPerm : perms) {
+		serialize(currentPerm.get(), buffer);
+	}
+}
+
+std::optional< ExplicitPermutation > deserialize(const std::uint8_t *data, std::size_t size, std::size_t &offset) {
+	std::size_t currentOffset = offset;
+	ExplicitPermutation::image_type image;
+	std::vector< bool > seen;
+	int sign;
+
+	if (!readPermutation(data, size, currentOffset, image, sign, seen)) {
+		return {};
+	}
+
+	offset = currentOffset;
+
+	return ExplicitPermutation(std::move(image), sign);
+}
+
+bool deserializeTo(const std::uint8_t *data, std::size_t size, std::size_t &offset,
+				   std::vector< Permutation > &perms) {
+	std::size_t currentOffset = offset;
+
+	std::uint64_t count;
+	if (!readVarint(data, size, currentOffset, count) || count > size - currentOffset) {
+		// Every permutation takes up at least one byte
+		return false;
+	}
+
+	const std::size_t initialSize = perms.size();
+	perms.reserve(initialSize + static_cast< std::size_t >(count));
+
+	ExplicitPermutation::image_type image;
+	std::vector< bool > seen;
+	int sign;
+
+	for (std::uint64_t i = 0; i < count; ++i) {
+		if (!readPermutation(data, size, currentOffset, image, sign, seen)) {
+			perms.erase(perms.begin() + static_cast< std::ptrdiff_t >(initialSize), perms.end());
+
+			return false;
+		}
+
+		perms.push_back(ExplicitPermutation(image, sign));
+	}
+
+	offset = currentOffset;
+
+	return true;
+}
+
+} // namespace perm
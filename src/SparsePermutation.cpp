@@ -0,0 +1,230 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/SparsePermutation.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <set>
+
+namespace perm {
+
+/**
+ * Appends all points that might be moved by the given permutation to the given list. For sparse permutations these are
+ * exactly the points in their support, for all others we have to assume that any point up to their maxElement() might
+ * be moved.
+ */
+static void appendSupportCandidates(const AbstractPermutation &perm,
+									std::vector< AbstractPermutation::value_type > &points) {
+	if (const SparsePermutation *sparse = dynamic_cast< const SparsePermutation * >(&perm)) {
+		for (const SparsePermutation::mapping_type &currentMapping : sparse->mapping()) {
+			points.push_back(currentMapping.first);
+		}
+	} else if (!perm.isIdentity()) {
+		for (AbstractPermutation::value_type i = 0; i <= perm.maxElement(); ++i) {
+			points.push_back(i);
+		}
+	}
+}
+
+/**
+ * @returns An iterator to the entry of the given (sorted) mapping that describes the given point or the end iterator,
+ * if there is no such entry
+ */
+static std::vector< SparsePermutation::mapping_type >::const_iterator
+	findMappingOf(const std::vector< SparsePermutation::mapping_type > &mapping,
+				  AbstractPermutation::value_type point) {
+	auto it = std::lower_bound(
+		mapping.begin(), mapping.end(), point,
+		[](const SparsePermutation::mapping_type &entry, AbstractPermutation::value_type value) {
+			return entry.first < value;
+		});
+
+	return it != mapping.end() && it->first == point ? it : mapping.end();
+}
+
+SparsePermutation::SparsePermutation(int sign) : details::SignedPermutation(sign) {
+}
+
+SparsePermutation::SparsePermutation(std::vector< mapping_type > mapping, int sign)
+	: details::SignedPermutation(sign), m_mapping(std::move(mapping)) {
+	normalize();
+}
+
+SparsePermutation::SparsePermutation(const Cycle &cycle, int sign) : details::SignedPermutation(sign) {
+	for (const Cycle::Span currentCycle : cycle) {
+		if (currentCycle.size() < 2) {
+			continue;
+		}
+
+		for (std::size_t i = 0; i < currentCycle.size(); ++i) {
+			m_mapping.emplace_back(currentCycle[i], currentCycle[(i + 1) % currentCycle.size()]);
+		}
+	}
+
+	normalize();
+}
+
+SparsePermutation::SparsePermutation(const AbstractPermutation &perm) : details::SignedPermutation(perm.sign()) {
+	if (const SparsePermutation *sparse = dynamic_cast< const SparsePermutation * >(&perm)) {
+		m_mapping = sparse->m_mapping;
+		return;
+	}
+
+	for (value_type i = 0; i <= perm.maxElement(); ++i) {
+		const value_type currentImage = perm.image(i);
+
+		if (currentImage != i) {
+			m_mapping.emplace_back(i, currentImage);
+		}
+	}
+}
+
+SparsePermutation::value_type SparsePermutation::maxElement() const {
+	return m_mapping.empty() ? 0 : m_mapping.back().first;
+}
+
+SparsePermutation::value_type SparsePermutation::image(value_type value) const {
+	auto it = findMappingOf(m_mapping, value);
+
+	return it == m_mapping.end() ? value : it->second;
+}
+
+const std::vector< SparsePermutation::mapping_type > &SparsePermutation::mapping() const {
+	return m_mapping;
+}
+
+std::size_t SparsePermutation::supportSize() const {
+	return m_mapping.size();
+}
+
+bool SparsePermutation::isIdentity() const {
+	return sign() > 0 && m_mapping.empty();
+}
+
+void SparsePermutation::invert() {
+	for (mapping_type &currentMapping : m_mapping) {
+		std::swap(currentMapping.first, currentMapping.second);
+	}
+
+	std::sort(m_mapping.begin(), m_mapping.end());
+}
+
+void SparsePermutation::preMultiply(const AbstractPermutation &other) {
+	details::SignedPermutation::preMultiply(other);
+
+	compose(other, *this);
+}
+
+void SparsePermutation::postMultiply(const AbstractPermutation &other) {
+	details::SignedPermutation::postMultiply(other);
+
+	compose(*this, other);
+}
+
+bool SparsePermutation::equals(const AbstractPermutation &other) const {
+	if (const SparsePermutation *sparse = dynamic_cast< const SparsePermutation * >(&other)) {
+		return sign() == sparse->sign() && m_mapping == sparse->m_mapping;
+	}
+
+	return AbstractPermutation::equals(other);
+}
+
+Cycle SparsePermutation::toCycle() const {
+	std::vector< std::vector< value_type > > cycles;
+	std::vector< bool > visited(m_mapping.size(), false);
+
+	for (std::size_t i = 0; i < m_mapping.size(); ++i) {
+		if (visited[i]) {
+			continue;
+		}
+
+		std::vector< value_type > currentCycle;
+
+		std::size_t current = i;
+		do {
+			visited[current] = true;
+			currentCycle.push_back(m_mapping[current].first);
+
+			// Every image point is moved as well and thus has its own entry in the mapping
+			auto next = findMappingOf(m_mapping, m_mapping[current].second);
+			assert(next != m_mapping.end());
+
+			current = static_cast< std::size_t >(next - m_mapping.begin());
+		} while (current != i);
+
+		cycles.push_back(std::move(currentCycle));
+	}
+
+	return Cycle(std::move(cycles));
+}
+
+void SparsePermutation::shift(int shift, std::size_t startIndex) {
+	for (mapping_type &currentMapping : m_mapping) {
+		if (currentMapping.first >= startIndex) {
+			assert(shift >= 0 || currentMapping.first >= static_cast< value_type >(-shift));
+
+			currentMapping.first += shift;
+		}
+		if (currentMapping.second >= startIndex) {
+			assert(shift >= 0 || currentMapping.second >= static_cast< value_type >(-shift));
+
+			currentMapping.second += shift;
+		}
+	}
+
+	// Shifting a contiguous range of points by a constant amount preserves their relative order
+	assert(std::is_sorted(m_mapping.begin(), m_mapping.end()));
+	assert(std::adjacent_find(m_mapping.begin(), m_mapping.end(),
+							  [](const mapping_type &lhs, const mapping_type &rhs) { return lhs.first == rhs.first; })
+		   == m_mapping.end());
+}
+
+void SparsePermutation::insertIntoStream(std::ostream &stream) const {
+	// Represent this object in disjoint cycle notation
+	stream << (sign() < 0 ? "-" : "+") << toCycle();
+}
+
+void SparsePermutation::compose(const AbstractPermutation &inner, const AbstractPermutation &outer) {
+	// Only points that are moved by at least one of the factors can be moved by their product
+	std::vector< value_type > points;
+	appendSupportCandidates(inner, points);
+	appendSupportCandidates(outer, points);
+
+	std::sort(points.begin(), points.end());
+	points.erase(std::unique(points.begin(), points.end()), points.end());
+
+	// inner and/or outer might be this object, so we can't write our mapping before we are done reading it
+	std::vector< mapping_type > mapping;
+	mapping.reserve(points.size());
+
+	for (value_type currentPoint : points) {
+		const value_type currentImage = outer.image(inner.image(currentPoint));
+
+		if (currentImage != currentPoint) {
+			mapping.emplace_back(currentPoint, currentImage);
+		}
+	}
+
+	// Assert that multiplication has not created any duplicate entries
+	assert(std::set< mapping_type >(mapping.begin(), mapping.end()).size() == mapping.size());
+
+	m_mapping.swap(mapping);
+}
+
+void SparsePermutation::normalize() {
+	m_mapping.erase(std::remove_if(m_mapping.begin(), m_mapping.end(),
+								   [](const mapping_type &entry) { return entry.first == entry.second; }),
+					m_mapping.end());
+
+	std::sort(m_mapping.begin(), m_mapping.end());
+
+	// Assert that the mapping is a bijection on the involved points
+	assert(std::adjacent_find(m_mapping.begin(), m_mapping.end(),
+							  [](const mapping_type &lhs, const mapping_type &rhs) { return lhs.first == rhs.first; })
+		   == m_mapping.end());
+}
+
+} // namespace perm
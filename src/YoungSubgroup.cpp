@@ -0,0 +1,560 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/YoungSubgroup.hpp"
+#include "libperm/AbstractPermutation.hpp"
+#include "libperm/Cycle.hpp"
+#include "libperm/ExplicitPermutation.hpp"
+#include "libperm/details/CheckedArithmetic.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+namespace perm {
+
+using value_type = AbstractPermutation::value_type;
+
+/**
+ * @returns Whether the given permutation of the local indices 0..k-1 is odd
+ */
+static bool isOddLocalPermutation(const std::vector< std::size_t > &localImage) {
+	std::vector< bool > visited(localImage.size(), false);
+	std::size_t transpositions = 0;
+
+	for (std::size_t i = 0; i < localImage.size(); ++i) {
+		if (visited[i]) {
+			continue;
+		}
+
+		// A cycle of length l can be written as a product of l - 1 transpositions
+		std::size_t j = i;
+		do {
+			visited[j] = true;
+			j          = localImage[j];
+			transpositions++;
+		} while (j != i);
+		transpositions--;
+	}
+
+	return transpositions % 2 != 0;
+}
+
+/**
+ * @returns The rank of the given permutation of the local indices 0..k-1 among all k! such permutations. It is the
+ * value of the permutation's Lehmer code interpreted as a number in the factorial number system.
+ */
+static std::size_t lehmerRank(const std::vector< std::size_t > &localImage) {
+	const std::size_t k = localImage.size();
+
+	std::size_t rank = 0;
+	for (std::size_t i = 0; i < k; ++i) {
+		// The i-th digit of the Lehmer code is the amount of subsequent images that are smaller than the i-th one
+		std::size_t digit = 0;
+		for (std::size_t j = i + 1; j < k; ++j) {
+			if (localImage[j] < localImage[i]) {
+				digit++;
+			}
+		}
+
+		// The i-th digit has the radix k - i
+		rank = rank * (k - i) + digit;
+	}
+
+	return rank;
+}
+
+/**
+ * Computes the permutation of the local indices 0..localImage.size()-1 that has the given rank (see lehmerRank)
+ *
+ * @returns Whether the computed permutation is odd
+ */
+static bool lehmerUnrank(std::size_t rank, std::vector< std::size_t > &localImage) {
+	const std::size_t k = localImage.size();
+
+	std::vector< std::size_t > digits(k);
+	for (std::size_t i = k; i-- > 0;) {
+		digits[i] = rank % (k - i);
+		rank /= k - i;
+	}
+
+	std::vector< std::size_t > remaining(k);
+	std::iota(remaining.begin(), remaining.end(), 0);
+
+	// The digits count the inversions of the permutation and thus their sum determines its parity
+	std::size_t inversions = 0;
+	for (std::size_t i = 0; i < k; ++i) {
+		localImage[i] = remaining[digits[i]];
+		remaining.erase(remaining.begin() + static_cast< std::ptrdiff_t >(digits[i]));
+
+		inversions += digits[i];
+	}
+
+	return inversions % 2 != 0;
+}
+
+YoungSubgroup::YoungSubgroup() : AbstractPermutationGroup(PermutationGroupType::Young) {
+	setGenerators({});
+}
+
+YoungSubgroup::YoungSubgroup(std::vector< Permutation > generators)
+	: AbstractPermutationGroup(PermutationGroupType::Young) {
+	setGenerators(std::move(generators));
+}
+
+YoungSubgroup::YoungSubgroup(const std::vector< Range > &ranges, bool antisymmetric)
+	: AbstractPermutationGroup(PermutationGroupType::Young) {
+	for (const Range &currentRange : ranges) {
+		assert(currentRange.first <= currentRange.second);
+
+		if (currentRange.first == currentRange.second) {
+			// A range consisting of a single point does not permute anything
+			continue;
+		}
+
+		Block block;
+		block.points.resize(currentRange.second - currentRange.first + 1);
+		std::iota(block.points.begin(), block.points.end(), currentRange.first);
+		block.antisymmetric = antisymmetric;
+
+		m_blocks.push_back(std::move(block));
+	}
+
+	updateBlockIndices();
+	updateGenerators();
+}
+
+std::vector< AbstractPermutation::value_type >
+	YoungSubgroup::orbit(AbstractPermutation::value_type point) const {
+	const std::size_t index = blockIndex(point);
+
+	if (index == noBlock) {
+		return { point };
+	}
+
+	return m_blocks[index].points;
+}
+
+std::size_t YoungSubgroup::order() const {
+	std::size_t order = 1;
+
+	for (const Block &currentBlock : m_blocks) {
+		order = details::checkedOrderProduct(order, details::checkedFactorial(currentBlock.points.size()));
+	}
+
+	return order;
+}
+
+bool YoungSubgroup::contains(const AbstractPermutation &perm) const {
+	const value_type n = perm.maxElement();
+
+	// Every point has to be mapped into the block it belongs to
+	for (value_type i = 0; i <= n; ++i) {
+		const std::size_t index = blockIndex(i);
+
+		if (index != blockIndex(perm.image(i)) || (index == noBlock && perm.image(i) != i)) {
+			return false;
+		}
+	}
+
+	// The sign of the permutation has to match the parity of its action on the antisymmetric blocks
+	std::vector< bool > visited(n + 1, false);
+	std::size_t transpositions = 0;
+
+	for (value_type i = 0; i <= n; ++i) {
+		const std::size_t index = blockIndex(i);
+		if (visited[i] || index == noBlock || !m_blocks[index].antisymmetric) {
+			continue;
+		}
+
+		value_type j = i;
+		do {
+			visited[j] = true;
+			j          = perm.image(j);
+			transpositions++;
+		} while (j != i);
+		transpositions--;
+	}
+
+	return perm.sign() == (transpositions % 2 == 0 ? 1 : -1);
+}
+
+bool YoungSubgroup::addGenerator(Permutation perm) {
+	if (contains(perm.get())) {
+		return false;
+	}
+
+	// Only transpositions keep the group a Young subgroup
+	std::vector< value_type > movedPoints;
+	for (value_type i = 0; i <= perm->maxElement(); ++i) {
+		if (perm->image(i) != i) {
+			movedPoints.push_back(i);
+		}
+	}
+
+	const bool antisymmetric = perm->sign() < 0;
+
+	if (movedPoints.size() != 2) {
+		throw std::invalid_argument("Only transpositions can be used as generators of a Young subgroup");
+	}
+
+	for (value_type currentPoint : movedPoints) {
+		const std::size_t index = blockIndex(currentPoint);
+
+		if (index != noBlock && m_blocks[index].antisymmetric != antisymmetric) {
+			throw std::invalid_argument("The generator's sign does not match the symmetry of the blocks it acts on");
+		}
+	}
+
+	mergeBlocks(movedPoints[0], movedPoints[1], antisymmetric);
+
+	updateBlockIndices();
+	updateGenerators();
+
+	return true;
+}
+
+void YoungSubgroup::setGenerators(std::vector< Permutation > generators) {
+	std::vector< Block > previousBlocks = std::move(m_blocks);
+	m_blocks.clear();
+	m_blockIndices.clear();
+
+	try {
+		for (Permutation &currentGenerator : generators) {
+			addGenerator(std::move(currentGenerator));
+		}
+	} catch (...) {
+		// Leave this group unchanged if any of the generators is invalid
+		m_blocks = std::move(previousBlocks);
+		updateBlockIndices();
+		updateGenerators();
+
+		throw;
+	}
+
+	updateGenerators();
+}
+
+const std::vector< Permutation > &YoungSubgroup::getGenerators() const {
+	return m_generators;
+}
+
+void YoungSubgroup::getElementsTo(std::vector< Permutation > &permutations) const {
+	permutations.clear();
+	permutations.reserve(order());
+
+	value_type n = 0;
+	if (!m_blockIndices.empty()) {
+		n = static_cast< value_type >(m_blockIndices.size() - 1);
+	}
+
+	// Every element corresponds to a combination of arrangements of the points within the individual blocks.
+	// We iterate over all of these combinations in an odometer-like fashion.
+	std::vector< std::vector< std::size_t > > arrangements(m_blocks.size());
+	for (std::size_t i = 0; i < m_blocks.size(); ++i) {
+		arrangements[i].resize(m_blocks[i].points.size());
+		std::iota(arrangements[i].begin(), arrangements[i].end(), 0);
+	}
+
+	std::vector< value_type > image(n + 1);
+
+	while (true) {
+		std::iota(image.begin(), image.end(), 0);
+		bool negative = false;
+
+		for (std::size_t i = 0; i < m_blocks.size(); ++i) {
+			const Block &currentBlock = m_blocks[i];
+
+			for (std::size_t k = 0; k < currentBlock.points.size(); ++k) {
+				image[currentBlock.points[k]] = currentBlock.points[arrangements[i][k]];
+			}
+
+			if (currentBlock.antisymmetric && isOddLocalPermutation(arrangements[i])) {
+				negative = !negative;
+			}
+		}
+
+		permutations.push_back(ExplicitPermutation(image, negative ? -1 : 1));
+
+		std::size_t i = 0;
+		while (i < arrangements.size() && !std::next_permutation(arrangements[i].begin(), arrangements[i].end())) {
+			// This block has wrapped around to its initial arrangement -> move on to the next one
+			++i;
+		}
+
+		if (i == arrangements.size()) {
+			break;
+		}
+	}
+
+	assert(permutations.size() == order());
+}
+
+std::size_t YoungSubgroup::rank(const AbstractPermutation &perm) const {
+	if (!contains(perm)) {
+		return order();
+	}
+
+	// The rank is a mixed-radix number whose i-th digit is the rank of the arrangement of the points within the i-th
+	// block (with radix |block|!). The sign doesn't have to be encoded, as it follows from these arrangements.
+	std::size_t rank   = 0;
+	std::size_t stride = 1;
+
+	std::vector< std::size_t > localImage;
+	for (const Block &currentBlock : m_blocks) {
+		const std::vector< value_type > &points = currentBlock.points;
+
+		localImage.resize(points.size());
+		for (std::size_t k = 0; k < points.size(); ++k) {
+			localImage[k] = static_cast< std::size_t >(
+				std::lower_bound(points.begin(), points.end(), perm.image(points[k])) - points.begin());
+		}
+
+		// The stride never exceeds the group's order, which also bounds the (local) ranks
+		const std::size_t blockOrder = details::checkedFactorial(points.size());
+		const std::size_t nextStride = details::checkedOrderProduct(stride, blockOrder);
+
+		rank += lehmerRank(localImage) * stride;
+		stride = nextStride;
+	}
+
+	return rank;
+}
+
+Permutation YoungSubgroup::unrank(std::size_t rank) const {
+	assert(rank < order());
+
+	ExplicitPermutation::image_type image(m_blockIndices.size());
+	std::iota(image.begin(), image.end(), 0);
+	bool negative = false;
+
+	std::vector< std::size_t > localImage;
+	for (const Block &currentBlock : m_blocks) {
+		const std::vector< value_type > &points = currentBlock.points;
+
+		const std::size_t blockOrder = details::checkedFactorial(points.size());
+
+		localImage.resize(points.size());
+		const bool odd = lehmerUnrank(rank % blockOrder, localImage);
+		rank /= blockOrder;
+
+		for (std::size_t k = 0; k < points.size(); ++k) {
+			image[points[k]] = points[localImage[k]];
+		}
+
+		if (currentBlock.antisymmetric && odd) {
+			negative = !negative;
+		}
+	}
+
+	return ExplicitPermutation(std::move(image), negative ? -1 : 1);
+}
+
+std::vector< Permutation > YoungSubgroup::leftCoset(const AbstractPermutation &perm) const {
+	std::vector< Permutation > coset;
+	getElementsTo(coset);
+
+	for (Permutation &currentElement : coset) {
+		currentElement->preMultiply(perm);
+	}
+
+	return coset;
+}
+
+std::vector< Permutation > YoungSubgroup::rightCoset(const AbstractPermutation &perm) const {
+	std::vector< Permutation > coset;
+	getElementsTo(coset);
+
+	for (Permutation &currentElement : coset) {
+		currentElement->postMultiply(perm);
+	}
+
+	return coset;
+}
+
+Permutation YoungSubgroup::leftCosetRepresentative(const AbstractPermutation &perm) const {
+	// The elements of the left coset are g * h where h permutes points within blocks. The image of i under g * h
+	// is h(g(i)). Going through the points in ascending order, the lexicographically smallest image is obtained by
+	// always mapping g(i) to the smallest point in its block that has not been used yet.
+	value_type n = perm.maxElement();
+	if (!m_blockIndices.empty()) {
+		n = std::max(n, static_cast< value_type >(m_blockIndices.size() - 1));
+	}
+
+	ExplicitPermutation::image_type image(n + 1);
+	std::vector< std::size_t > nextPoint(m_blocks.size(), 0);
+	std::vector< std::vector< std::size_t > > localImages(m_blocks.size());
+	for (std::size_t i = 0; i < m_blocks.size(); ++i) {
+		localImages[i].resize(m_blocks[i].points.size());
+	}
+
+	for (value_type i = 0; i <= n; ++i) {
+		const value_type current = perm.image(i);
+		const std::size_t index  = blockIndex(current);
+
+		if (index == noBlock) {
+			image[i] = current;
+			continue;
+		}
+
+		const std::vector< value_type > &points = m_blocks[index].points;
+		const std::size_t localIndex =
+			static_cast< std::size_t >(std::lower_bound(points.begin(), points.end(), current) - points.begin());
+
+		localImages[index][localIndex] = nextPoint[index];
+		image[i]                       = points[nextPoint[index]];
+		nextPoint[index]++;
+	}
+
+	int sign = perm.sign();
+	for (std::size_t i = 0; i < m_blocks.size(); ++i) {
+		if (m_blocks[i].antisymmetric && isOddLocalPermutation(localImages[i])) {
+			sign *= -1;
+		}
+	}
+
+	return ExplicitPermutation(std::move(image), sign);
+}
+
+Permutation YoungSubgroup::rightCosetRepresentative(const AbstractPermutation &perm) const {
+	// The elements of the right coset are h * g where h permutes points within blocks. The image of i under h * g
+	// is g(h(i)). Thus, the lexicographically smallest image is obtained by sorting the images of the points in
+	// every block.
+	value_type n = perm.maxElement();
+	if (!m_blockIndices.empty()) {
+		n = std::max(n, static_cast< value_type >(m_blockIndices.size() - 1));
+	}
+
+	ExplicitPermutation::image_type image(n + 1);
+	for (value_type i = 0; i <= n; ++i) {
+		image[i] = perm.image(i);
+	}
+
+	int sign = perm.sign();
+	std::vector< std::size_t > localImage;
+
+	for (const Block &currentBlock : m_blocks) {
+		const std::vector< value_type > &points = currentBlock.points;
+
+		localImage.resize(points.size());
+		std::iota(localImage.begin(), localImage.end(), 0);
+		std::sort(localImage.begin(), localImage.end(),
+				  [&](std::size_t lhs, std::size_t rhs) { return perm.image(points[lhs]) < perm.image(points[rhs]); });
+
+		for (std::size_t k = 0; k < points.size(); ++k) {
+			image[points[k]] = perm.image(points[localImage[k]]);
+		}
+
+		if (currentBlock.antisymmetric && isOddLocalPermutation(localImage)) {
+			sign *= -1;
+		}
+	}
+
+	return ExplicitPermutation(std::move(image), sign);
+}
+
+std::ostream &operator<<(std::ostream &stream, const YoungSubgroup &group) {
+	stream << "Young subgroup over { ";
+	for (std::size_t i = 0; i < group.m_blocks.size(); ++i) {
+		stream << (group.m_blocks[i].antisymmetric ? "-" : "+") << "[ ";
+		for (value_type currentPoint : group.m_blocks[i].points) {
+			stream << currentPoint << " ";
+		}
+		stream << "]";
+
+		if (i + 1 < group.m_blocks.size()) {
+			stream << ", ";
+		}
+	}
+
+	return stream << " }";
+}
+
+std::size_t YoungSubgroup::blockIndex(AbstractPermutation::value_type point) const {
+	if (point >= m_blockIndices.size()) {
+		return noBlock;
+	}
+
+	return m_blockIndices[point];
+}
+
+void YoungSubgroup::mergeBlocks(AbstractPermutation::value_type first, AbstractPermutation::value_type second,
+								bool antisymmetric) {
+	const std::size_t firstIndex  = blockIndex(first);
+	const std::size_t secondIndex = blockIndex(second);
+
+	assert(firstIndex == noBlock || firstIndex != secondIndex);
+
+	Block merged;
+	merged.antisymmetric = antisymmetric;
+
+	for (std::size_t index : { firstIndex, secondIndex }) {
+		if (index != noBlock) {
+			merged.points.insert(merged.points.end(), m_blocks[index].points.begin(), m_blocks[index].points.end());
+		}
+	}
+	if (firstIndex == noBlock) {
+		merged.points.push_back(first);
+	}
+	if (secondIndex == noBlock) {
+		merged.points.push_back(second);
+	}
+
+	std::sort(merged.points.begin(), merged.points.end());
+
+	// Remove the old blocks (higher index first, so that the lower index remains valid)
+	for (std::size_t index : { std::max(firstIndex, secondIndex), std::min(firstIndex, secondIndex) }) {
+		if (index != noBlock) {
+			m_blocks.erase(m_blocks.begin() + static_cast< std::ptrdiff_t >(index));
+		}
+	}
+
+	m_blocks.push_back(std::move(merged));
+
+	// Keep blocks ordered by their smallest point, so that the representation does not depend on the order in which
+	// generators have been added
+	std::sort(m_blocks.begin(), m_blocks.end(),
+			  [](const Block &lhs, const Block &rhs) { return lhs.points.front() < rhs.points.front(); });
+}
+
+void YoungSubgroup::updateBlockIndices() {
+	value_type maxPoint = 0;
+	for (const Block &currentBlock : m_blocks) {
+		assert(currentBlock.points.size() > 1);
+		maxPoint = std::max(maxPoint, currentBlock.points.back());
+	}
+
+	m_blockIndices.assign(m_blocks.empty() ? 0 : maxPoint + 1, noBlock);
+
+	for (std::size_t i = 0; i < m_blocks.size(); ++i) {
+		for (value_type currentPoint : m_blocks[i].points) {
+			// Blocks must not overlap
+			assert(m_blockIndices[currentPoint] == noBlock);
+
+			m_blockIndices[currentPoint] = i;
+		}
+	}
+}
+
+void YoungSubgroup::updateGenerators() {
+	m_generators.clear();
+
+	// The symmetric group over a block is generated by the transpositions of adjacent points
+	for (const Block &currentBlock : m_blocks) {
+		for (std::size_t i = 1; i < currentBlock.points.size(); ++i) {
+			m_generators.emplace_back(ExplicitPermutation(Cycle({ currentBlock.points[i - 1], currentBlock.points[i] }),
+														  currentBlock.antisymmetric ? -1 : 1));
+		}
+	}
+
+	if (m_generators.empty()) {
+		// There is no such thing as an empty group. It must always at least contain the identity element
+		m_generators.emplace_back(ExplicitPermutation());
+	}
+}
+
+} // namespace perm
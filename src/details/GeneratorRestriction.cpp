@@ -0,0 +1,51 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/details/GeneratorRestriction.hpp"
+#include "libperm/AbstractPermutation.hpp"
+
+#include <algorithm>
+
+namespace perm::details {
+
+std::vector< Permutation > restrictGenerators(const std::vector< Permutation > &generators,
+											  std::vector< std::size_t > excludes) {
+	std::sort(excludes.begin(), excludes.end());
+
+	std::vector< Permutation > restricted;
+
+	for (const Permutation &currentPerm : generators) {
+		if (currentPerm->isIdentity()) {
+			continue;
+		}
+
+		const bool include = std::none_of(excludes.begin(), excludes.end(), [&](std::size_t currentExclude) {
+			return currentPerm->image(static_cast< AbstractPermutation::value_type >(currentExclude))
+				   != static_cast< AbstractPermutation::value_type >(currentExclude);
+		});
+
+		if (!include) {
+			// This permutation is acting on an excluded position -> this won't be part of the resulting symmetry
+			continue;
+		}
+
+		Permutation copy = currentPerm;
+
+		// Account for removed elements
+		for (std::size_t offset : excludes) {
+			if (offset > copy->maxElement()) {
+				break;
+			}
+
+			copy->shift(-1, offset);
+		}
+
+		restricted.push_back(std::move(copy));
+	}
+
+	return restricted;
+}
+
+} // namespace perm::details
@@ -0,0 +1,139 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/details/MappedFile.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace perm::details {
+
+MappedFile::MappedFile(const std::string &path) {
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+							  FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		return;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		CloseHandle(file);
+		return;
+	}
+
+	void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!data) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return;
+	}
+
+	m_fileHandle    = file;
+	m_mappingHandle = mapping;
+	m_data          = static_cast< const unsigned char * >(data);
+	m_size          = static_cast< std::size_t >(fileSize.QuadPart);
+#else
+	const int file = ::open(path.c_str(), O_RDONLY);
+	if (file < 0) {
+		return;
+	}
+
+	struct stat fileInfo;
+	if (::fstat(file, &fileInfo) != 0 || fileInfo.st_size <= 0) {
+		::close(file);
+		return;
+	}
+
+	void *data = ::mmap(nullptr, static_cast< std::size_t >(fileInfo.st_size), PROT_READ, MAP_SHARED, file, 0);
+
+	// The mapping stays valid after the file descriptor has been closed
+	::close(file);
+
+	if (data == MAP_FAILED) {
+		return;
+	}
+
+	m_data = static_cast< const unsigned char * >(data);
+	m_size = static_cast< std::size_t >(fileInfo.st_size);
+#endif
+}
+
+MappedFile::~MappedFile() {
+	close();
+}
+
+MappedFile::MappedFile(MappedFile &&other) {
+	*this = std::move(other);
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) {
+	if (this != &other) {
+		close();
+
+		std::swap(m_data, other.m_data);
+		std::swap(m_size, other.m_size);
+#ifdef _WIN32
+		std::swap(m_fileHandle, other.m_fileHandle);
+		std::swap(m_mappingHandle, other.m_mappingHandle);
+#endif
+	}
+
+	return *this;
+}
+
+bool MappedFile::isOpen() const {
+	return m_data != nullptr;
+}
+
+const unsigned char *MappedFile::data() const {
+	return m_data;
+}
+
+std::size_t MappedFile::size() const {
+	return m_size;
+}
+
+void MappedFile::close() {
+	if (!m_data) {
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(m_data);
+	CloseHandle(m_mappingHandle);
+	CloseHandle(m_fileHandle);
+
+	m_mappingHandle = nullptr;
+	m_fileHandle    = nullptr;
+#else
+	::munmap(const_cast< unsigned char * >(m_data), m_size);
+#endif
+
+	m_data = nullptr;
+	m_size = 0;
+}
+
+} // namespace perm::details
@@ -0,0 +1,276 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include "libperm/details/RingGroup.hpp"
+#include "libperm/ExplicitPermutation.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+namespace perm::details {
+
+RingGroup::RingGroup(PermutationGroupType type, AbstractPermutation::value_type n, bool reflections)
+	: AbstractPermutationGroup(type), m_n(n), m_reflections(reflections) {
+	if (m_n > 1) {
+		// The rotation i -> i + 1 generates all rotations
+		m_generators.emplace_back(ExplicitPermutation(elementImage(1, false)));
+
+		if (hasDistinctReflections()) {
+			// Together with a single reflection, all reflections are generated as well
+			m_generators.emplace_back(ExplicitPermutation(elementImage(0, true)));
+		}
+	} else {
+		// There is no such thing as an empty group. It must always at least contain the identity element
+		m_generators.emplace_back(ExplicitPermutation());
+	}
+}
+
+AbstractPermutation::value_type RingGroup::ringSize() const {
+	return m_n;
+}
+
+std::vector< AbstractPermutation::value_type > RingGroup::orbit(AbstractPermutation::value_type point) const {
+	if (point >= m_n) {
+		return { point };
+	}
+
+	std::vector< AbstractPermutation::value_type > orbit(m_n);
+	for (AbstractPermutation::value_type i = 0; i < m_n; ++i) {
+		orbit[i] = (point + i) % m_n;
+	}
+
+	return orbit;
+}
+
+std::size_t RingGroup::order() const {
+	if (m_n <= 1) {
+		return 1;
+	}
+
+	return hasDistinctReflections() ? 2 * static_cast< std::size_t >(m_n) : m_n;
+}
+
+bool RingGroup::contains(const AbstractPermutation &perm) const {
+	if (m_n <= 1) {
+		return perm.isIdentity();
+	}
+
+	if (perm.sign() < 0) {
+		return false;
+	}
+
+	// Points not on the ring must not be touched
+	for (AbstractPermutation::value_type i = m_n; i <= perm.maxElement(); ++i) {
+		if (perm.image(i) != i) {
+			return false;
+		}
+	}
+
+	// Every element of the group is uniquely determined by the image of 0 and whether it is a reflection
+	const AbstractPermutation::value_type offset = perm.image(0);
+	if (offset >= m_n) {
+		return false;
+	}
+
+	bool isRotation   = true;
+	bool isReflection = hasDistinctReflections();
+	for (AbstractPermutation::value_type i = 1; i < m_n && (isRotation || isReflection); ++i) {
+		isRotation   = isRotation && perm.image(i) == (offset + i) % m_n;
+		isReflection = isReflection && perm.image(i) == (offset + m_n - i) % m_n;
+	}
+
+	return isRotation || isReflection;
+}
+
+bool RingGroup::addGenerator(Permutation perm) {
+	// The group is fully determined by the ring's size and thus can't be extended
+	if (!contains(perm.get())) {
+		throw std::invalid_argument("Ring groups can't be extended by additional generators");
+	}
+
+	return false;
+}
+
+void RingGroup::setGenerators(std::vector< Permutation > generators) {
+	// The group is fully determined by the ring's size and thus its generators can't be changed
+	if (!std::all_of(generators.begin(), generators.end(),
+					 [this](const Permutation &current) { return contains(current.get()); })) {
+		throw std::invalid_argument("Ring groups can't be extended by additional generators");
+	}
+}
+
+const std::vector< Permutation > &RingGroup::getGenerators() const {
+	return m_generators;
+}
+
+void RingGroup::getElementsTo(std::vector< Permutation > &permutations) const {
+	permutations.clear();
+
+	if (m_n <= 1) {
+		permutations.emplace_back(ExplicitPermutation());
+		return;
+	}
+
+	permutations.reserve(order());
+
+	for (bool reflect : { false, true }) {
+		if (reflect && !hasDistinctReflections()) {
+			break;
+		}
+
+		for (AbstractPermutation::value_type offset = 0; offset < m_n; ++offset) {
+			permutations.emplace_back(ExplicitPermutation(elementImage(offset, reflect)));
+		}
+	}
+}
+
+std::size_t RingGroup::rank(const AbstractPermutation &perm) const {
+	if (!contains(perm)) {
+		return order();
+	}
+
+	if (m_n <= 1) {
+		return 0;
+	}
+
+	// The ranks follow the order of getElementsTo: the rotations by 0, ..., n-1 are followed by the reflections
+	const AbstractPermutation::value_type offset = perm.image(0);
+	const bool isReflection                      = perm.image(1) != (offset + 1) % m_n;
+
+	return isReflection ? m_n + offset : offset;
+}
+
+Permutation RingGroup::unrank(std::size_t rank) const {
+	assert(rank < order());
+
+	if (m_n <= 1) {
+		return ExplicitPermutation();
+	}
+
+	return ExplicitPermutation(
+		elementImage(static_cast< AbstractPermutation::value_type >(rank % m_n), rank >= m_n));
+}
+
+std::vector< Permutation > RingGroup::leftCoset(const AbstractPermutation &perm) const {
+	std::vector< Permutation > coset;
+	getElementsTo(coset);
+
+	for (Permutation &currentElement : coset) {
+		currentElement->preMultiply(perm);
+	}
+
+	return coset;
+}
+
+std::vector< Permutation > RingGroup::rightCoset(const AbstractPermutation &perm) const {
+	std::vector< Permutation > coset;
+	getElementsTo(coset);
+
+	for (Permutation &currentElement : coset) {
+		currentElement->postMultiply(perm);
+	}
+
+	return coset;
+}
+
+Permutation RingGroup::leftCosetRepresentative(const AbstractPermutation &perm) const {
+	if (m_n <= 1) {
+		return ExplicitPermutation(perm.toCycle(), perm.sign());
+	}
+
+	// The elements of the left coset are g * h where h is a rotation (or reflection) of the ring. Thus, the image of
+	// i is h(g(i)). The lexicographically smallest image is therefore obtained by choosing h such that the first point
+	// that is mapped onto the ring by g ends up at 0. There is exactly one rotation and one reflection that achieve
+	// this, so we only have to compare these two candidates.
+	const AbstractPermutation::value_type n = std::max(perm.maxElement(), m_n - 1);
+
+	AbstractPermutation::value_type first = 0;
+	while (perm.image(first) >= m_n) {
+		first++;
+	}
+	first = perm.image(first);
+
+	ExplicitPermutation::image_type image(n + 1);
+	ExplicitPermutation::image_type reflectedImage(hasDistinctReflections() ? n + 1 : 0);
+	for (AbstractPermutation::value_type i = 0; i <= n; ++i) {
+		const AbstractPermutation::value_type current = perm.image(i);
+
+		if (current >= m_n) {
+			image[i] = current;
+		} else {
+			image[i] = (current + m_n - first) % m_n;
+		}
+
+		if (hasDistinctReflections()) {
+			reflectedImage[i] = current >= m_n ? current : (first + m_n - current) % m_n;
+		}
+	}
+
+	if (hasDistinctReflections() && reflectedImage < image) {
+		image = std::move(reflectedImage);
+	}
+
+	return ExplicitPermutation(std::move(image), perm.sign());
+}
+
+Permutation RingGroup::rightCosetRepresentative(const AbstractPermutation &perm) const {
+	if (m_n <= 1) {
+		return ExplicitPermutation(perm.toCycle(), perm.sign());
+	}
+
+	// The elements of the right coset are h * g where h is a rotation (or reflection) of the ring. Thus, the image of
+	// i is g(h(i)), which means that h rotates (or reverses and rotates) the sequence g(0), ..., g(n-1). The
+	// lexicographically smallest of these sequences is the least rotation of the sequence (or its reverse). Since
+	// the entries of the sequence are all distinct, the least rotation simply starts at the position of the
+	// sequence's smallest element (no general least-rotation algorithm is needed). If reflections are present, rotation
+	// and reflection are distinguished by the smaller of the two neighbors of that element.
+	AbstractPermutation::value_type minPos = 0;
+	for (AbstractPermutation::value_type i = 1; i < m_n; ++i) {
+		if (perm.image(i) < perm.image(minPos)) {
+			minPos = i;
+		}
+	}
+
+	const bool reflect =
+		hasDistinctReflections() && perm.image((minPos + m_n - 1) % m_n) < perm.image((minPos + 1) % m_n);
+
+	const AbstractPermutation::value_type n = std::max(perm.maxElement(), m_n - 1);
+
+	ExplicitPermutation::image_type image(n + 1);
+	for (AbstractPermutation::value_type i = 0; i <= n; ++i) {
+		if (i >= m_n) {
+			image[i] = perm.image(i);
+		} else {
+			image[i] = perm.image(reflect ? (minPos + m_n - i) % m_n : (minPos + i) % m_n);
+		}
+	}
+
+	return ExplicitPermutation(std::move(image), perm.sign());
+}
+
+std::ostream &operator<<(std::ostream &stream, const RingGroup &group) {
+	return stream << (group.type() == PermutationGroupType::Dihedral ? "dihedral" : "cyclic") << " group over "
+				  << group.m_n << " points";
+}
+
+bool RingGroup::hasDistinctReflections() const {
+	// For rings of up to two points, every reflection is also a rotation
+	return m_reflections && m_n > 2;
+}
+
+std::vector< AbstractPermutation::value_type > RingGroup::elementImage(AbstractPermutation::value_type offset,
+																		bool reflect) const {
+	std::vector< AbstractPermutation::value_type > image(m_n);
+
+	for (AbstractPermutation::value_type i = 0; i < m_n; ++i) {
+		image[i] = reflect ? (offset + m_n - i) % m_n : (offset + i) % m_n;
+	}
+
+	return image;
+}
+
+} // namespace perm::details
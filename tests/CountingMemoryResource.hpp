@@ -0,0 +1,42 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#ifndef LIBPERM_TESTS_COUNTINGMEMORYRESOURCE_HPP_
+#define LIBPERM_TESTS_COUNTINGMEMORYRESOURCE_HPP_
+
+#include <libperm/MemoryResource.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * A memory resource that forwards to the new/delete resource while keeping track of the allocations made through it
+ */
+class CountingMemoryResource : public perm::pmr::memory_resource {
+public:
+	std::size_t allocations() const { return m_allocations; }
+
+	std::size_t liveAllocations() const { return m_allocations - m_deallocations; }
+
+protected:
+	std::atomic< std::size_t > m_allocations{ 0 };
+	std::atomic< std::size_t > m_deallocations{ 0 };
+
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+		++m_allocations;
+
+		return perm::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+		++m_deallocations;
+
+		perm::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+
+	bool do_is_equal(const perm::pmr::memory_resource &other) const noexcept override { return this == &other; }
+};
+
+#endif // LIBPERM_TESTS_COUNTINGMEMORYRESOURCE_HPP_
@@ -5,8 +5,12 @@
 
 #include <libperm/Cycle.hpp>
 
+#include "CountingMemoryResource.hpp"
+
 #include <gtest/gtest.h>
 
+#include <vector>
+
 TEST(Cycle, construction) {
 	perm::Cycle c1;
 	// (1,2)
@@ -74,3 +78,58 @@ TEST(Cycle, fromImage) {
 	expected = perm::Cycle({ 0, 1, 2 });
 	ASSERT_EQ(perm::Cycle::fromImage(image), expected);
 }
+
+TEST(Cycle, memoryResource) {
+	CountingMemoryResource resource;
+
+	{
+		const perm::Cycle cycle({ { 0, 1 }, { 2, 3, 4 } }, &resource);
+		ASSERT_EQ(cycle.get_allocator().resource(), &resource);
+		ASSERT_EQ(cycle, perm::Cycle({ { 0, 1 }, { 2, 3, 4 } }));
+		ASSERT_GT(resource.allocations(), 0);
+
+		const std::vector< perm::Cycle::value_type > image = { 1, 2, 0 };
+		const perm::Cycle fromImage = perm::Cycle::fromImage(image, &resource);
+		ASSERT_EQ(fromImage.get_allocator().resource(), &resource);
+		ASSERT_EQ(fromImage, perm::Cycle({ 0, 1, 2 }));
+
+		const perm::Cycle copy(fromImage, perm::pmr::new_delete_resource());
+		ASSERT_EQ(copy.get_allocator().resource(), perm::pmr::new_delete_resource());
+		ASSERT_EQ(copy, fromImage);
+	}
+
+	ASSERT_EQ(resource.liveAllocations(), 0);
+}
+
+TEST(Cycle, iteration) {
+	const perm::Cycle cycle({ { 0, 3, 5 }, {}, { 2, 1 }, { 7 } });
+
+	ASSERT_EQ(cycle.size(), 4);
+
+	const std::vector< std::vector< perm::Cycle::value_type > > expected = { { 0, 3, 5 }, {}, { 2, 1 }, { 7 } };
+
+	std::size_t index = 0;
+	for (const perm::Cycle::Span currentCycle : cycle) {
+		ASSERT_LT(index, expected.size());
+		ASSERT_EQ(std::vector< perm::Cycle::value_type >(currentCycle.begin(), currentCycle.end()), expected[index]);
+		ASSERT_EQ(currentCycle, cycle[index]);
+		ASSERT_EQ(currentCycle.size(), expected[index].size());
+
+		index++;
+	}
+	ASSERT_EQ(index, expected.size());
+
+	ASSERT_EQ(cycle[0].front(), 0);
+	ASSERT_EQ(cycle[0].back(), 5);
+	ASSERT_TRUE(cycle[1].empty());
+
+	// Fixed points are not part of the decomposition of an image
+	const perm::Cycle decomposed = perm::Cycle::fromImage(std::vector< unsigned int >{ 0, 2, 3, 1, 4, 6, 5 });
+	ASSERT_EQ(decomposed.size(), 2);
+	ASSERT_EQ(std::vector< perm::Cycle::value_type >(decomposed[0].begin(), decomposed[0].end()),
+			  std::vector< perm::Cycle::value_type >({ 1, 2, 3 }));
+	ASSERT_EQ(std::vector< perm::Cycle::value_type >(decomposed[1].begin(), decomposed[1].end()),
+			  std::vector< perm::Cycle::value_type >({ 5, 6 }));
+
+	ASSERT_EQ(perm::Cycle::fromImage(std::vector< unsigned int >{ 0, 1, 2 }).size(), 0);
+}
@@ -237,3 +237,28 @@ TEST(DiminoAlgorithm, extendGroup) {
 	ASSERT_EQ(elements.size(), expectedElements.size());
 	ASSERT_TRUE(std::is_permutation(elements.begin(), elements.end(), expectedElements.begin()));
 }
+
+TEST(DiminoAlgorithm, multiThreaded) {
+	// Build up Sym(8) from adjacent transpositions, so that the last extension adds cosets of Sym(7)
+	std::vector< perm::Permutation > generators;
+	for (perm::AbstractPermutation::value_type i = 0; i < 7; ++i) {
+		generators.push_back(perm::ExplicitPermutation(perm::Cycle({ i, i + 1 }), -1));
+	}
+
+	const std::vector< perm::Permutation > sequentialElements =
+		perm::DiminoAlgorithm::generateGroupElements(generators);
+
+	ASSERT_EQ(sequentialElements.size(), faculty(8));
+
+	for (std::size_t threadCount : { 0, 2, 4 }) {
+		const std::vector< perm::Permutation > parallelElements =
+			perm::DiminoAlgorithm::generateGroupElements(generators, threadCount);
+
+		// The result has to be deterministic, that is independent of the amount of used threads
+		ASSERT_EQ(parallelElements, sequentialElements) << "Thread count: " << threadCount;
+
+		for (std::size_t i = 0; i < parallelElements.size(); ++i) {
+			ASSERT_EQ(parallelElements[i]->sign(), sequentialElements[i]->sign());
+		}
+	}
+}
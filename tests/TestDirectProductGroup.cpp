@@ -0,0 +1,155 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/Cycle.hpp>
+#include <libperm/CyclicGroup.hpp>
+#include <libperm/DirectProductGroup.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/PrimitivePermutationGroup.hpp>
+#include <libperm/SpecialGroups.hpp>
+#include <libperm/YoungSubgroup.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+
+TEST(DirectProductGroup, construction) {
+	perm::DirectProductGroup group;
+
+	ASSERT_EQ(group.order(), 1);
+	ASSERT_EQ(group.type(), perm::PermutationGroupType::DirectProduct);
+	ASSERT_TRUE(group.getFactors().empty());
+
+	// Generators acting on disjoint ranges of points are split into separate factors
+	group = perm::DirectProductGroup({ perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+									   perm::ExplicitPermutation(perm::Cycle({ 4, 6 })),
+									   perm::ExplicitPermutation(perm::Cycle({ 1, 2 })),
+									   perm::ExplicitPermutation(perm::Cycle({ 5, 4 })) });
+
+	ASSERT_EQ(group.order(), 6 * 6);
+	ASSERT_EQ(group.getFactors().size(), 2);
+	ASSERT_EQ(group.getFactors()[0].offset, 0);
+	ASSERT_EQ(group.getFactors()[0].size, 3);
+	ASSERT_EQ(group.getFactors()[1].offset, 4);
+	ASSERT_EQ(group.getFactors()[1].size, 3);
+
+	// Connecting the two blocks merges the factors
+	ASSERT_TRUE(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 2, 3 }))));
+	ASSERT_EQ(group.order(), 24 * 6);
+	ASSERT_EQ(group.getFactors().size(), 2);
+
+	ASSERT_TRUE(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 3, 4 }))));
+	ASSERT_EQ(group.order(), 5040);
+	ASSERT_EQ(group.getFactors().size(), 1);
+
+	ASSERT_FALSE(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 0, 6 }))));
+}
+
+TEST(DirectProductGroup, signedFactors) {
+	// Both blocks contain the negative identity, so the products of elements with flipped signs coincide
+	const std::vector< perm::Permutation > generators = {
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+		perm::ExplicitPermutation(perm::Cycle({ 4, 5 }), -1),
+		perm::ExplicitPermutation(perm::Cycle({ 4, 5 })),
+	};
+	const perm::DirectProductGroup group(generators);
+	const perm::PrimitivePermutationGroup expected(generators);
+
+	ASSERT_EQ(group.order(), 8);
+	ASSERT_EQ(group.getFactors().size(), 1);
+	ASSERT_EQ(group, expected);
+
+	std::vector< perm::Permutation > elements;
+	group.getElementsTo(elements);
+	std::vector< perm::Permutation > expectedElements;
+	expected.getElementsTo(expectedElements);
+	ASSERT_THAT(elements, ::testing::UnorderedElementsAreArray(expectedElements));
+
+	// The same applies when appending signed groups as factors
+	perm::DirectProductGroup product;
+	product.append(perm::PrimitivePermutationGroup({ generators[0], generators[1] }), 0);
+	product.append(perm::YoungSubgroup({ { 0, 1 } }), 2);
+	product.append(perm::PrimitivePermutationGroup({ generators[0], generators[1] }), 4);
+
+	ASSERT_EQ(product.order(), 16);
+	const perm::ExplicitPermutation middleGenerator(perm::Cycle({ 2, 3 }));
+	const perm::PrimitivePermutationGroup expectedProduct(
+		{ generators[0], generators[1], middleGenerator, generators[2], generators[3] });
+	ASSERT_EQ(product, expectedProduct);
+}
+
+TEST(DirectProductGroup, orderOverflow) {
+	perm::DirectProductGroup product;
+	product.append(perm::YoungSubgroup({ { 0, 19 } }), 0);
+	ASSERT_EQ(product.order(), 2432902008176640000u);
+
+	// 20! * 4! exceeds 64 bits
+	product.append(perm::YoungSubgroup({ { 0, 3 } }), 20);
+	ASSERT_THROW(product.order(), std::overflow_error);
+	ASSERT_THROW(product.rank(perm::ExplicitPermutation(perm::Cycle({ 20, 21 }))), std::overflow_error);
+	ASSERT_TRUE(product.contains(perm::ExplicitPermutation(perm::Cycle({ 20, 21 }))));
+}
+
+TEST(DirectProductGroup, consistentWithPrimitiveGroup) {
+	perm::DirectProductGroup product;
+	product.append(perm::Sym(3), 0);
+	product.append(perm::Cyclic(4), 4);
+	product.append(perm::YoungSubgroup({ { 0, 1 } }, true), 8);
+
+	ASSERT_EQ(product.getFactors().size(), 3);
+
+	const perm::PrimitivePermutationGroup primitive(product.getGenerators());
+
+	ASSERT_EQ(product.order(), primitive.order());
+	ASSERT_EQ(product, primitive);
+
+	std::vector< perm::Permutation > productElements;
+	std::vector< perm::Permutation > primitiveElements;
+	product.getElementsTo(productElements);
+	primitive.getElementsTo(primitiveElements);
+
+	ASSERT_THAT(productElements, ::testing::UnorderedElementsAreArray(primitiveElements));
+
+	for (perm::AbstractPermutation::value_type i = 0; i < 12; ++i) {
+		ASSERT_THAT(product.orbit(i), ::testing::UnorderedElementsAreArray(primitive.orbit(i)));
+	}
+
+	const std::vector< perm::ExplicitPermutation > cosetGenerators = {
+		perm::ExplicitPermutation(),
+		perm::ExplicitPermutation(perm::Cycle({ 8, 9 })),
+		perm::ExplicitPermutation(perm::Cycle({ 8, 9 }), -1),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 4 })),
+		perm::ExplicitPermutation(perm::Cycle({ { 2, 6, 9 }, { 1, 10 } }), -1),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 3, 6, 9, 1, 4, 7, 10, 2, 5, 8, 11 })),
+		perm::ExplicitPermutation(perm::Cycle({ { 0, 11 }, { 1, 10 }, { 2, 9 }, { 3, 8 }, { 4, 7 } })),
+	};
+
+	for (const perm::ExplicitPermutation &currentPerm : cosetGenerators) {
+		ASSERT_EQ(product.contains(currentPerm), primitive.contains(currentPerm)) << "Perm: " << currentPerm;
+
+		const perm::Permutation leftRepresentative  = product.leftCosetRepresentative(currentPerm);
+		const perm::Permutation rightRepresentative = product.rightCosetRepresentative(currentPerm);
+
+		ASSERT_EQ(leftRepresentative, primitive.leftCosetRepresentative(currentPerm))
+			<< "Coset generator: " << currentPerm;
+		ASSERT_EQ(leftRepresentative->sign(), primitive.leftCosetRepresentative(currentPerm)->sign())
+			<< "Coset generator: " << currentPerm;
+
+		ASSERT_EQ(rightRepresentative, primitive.rightCosetRepresentative(currentPerm))
+			<< "Coset generator: " << currentPerm;
+		ASSERT_EQ(rightRepresentative->sign(), primitive.rightCosetRepresentative(currentPerm)->sign())
+			<< "Coset generator: " << currentPerm;
+
+		EXPECT_THAT(product.leftCoset(currentPerm),
+					::testing::UnorderedElementsAreArray(primitive.leftCoset(currentPerm)));
+		EXPECT_THAT(product.rightCoset(currentPerm),
+					::testing::UnorderedElementsAreArray(primitive.rightCoset(currentPerm)));
+	}
+}
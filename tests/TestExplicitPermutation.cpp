@@ -4,10 +4,18 @@
 // <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
 
 #include <libperm/ExplicitPermutation.hpp>
+#include <libperm/Permutation.hpp>
+
+#include "CountingMemoryResource.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <set>
+#include <unordered_map>
+#include <vector>
 
 TEST(ExplicitPermutation, construction) {
 	perm::ExplicitPermutation perm;
@@ -27,7 +35,7 @@ TEST(ExplicitPermutation, construction) {
 	perm = perm::ExplicitPermutation({ 1, 2, 0 });
 
 	ASSERT_EQ(perm.maxElement(), static_cast< perm::AbstractPermutation::value_type >(2));
-	std::vector< perm::AbstractPermutation::value_type > expectedImage = { 1, 2, 0 };
+	perm::ExplicitPermutation::image_type expectedImage = { 1, 2, 0 };
 	ASSERT_EQ(perm.image(), expectedImage);
 
 	perm          = perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3 }));
@@ -46,6 +54,65 @@ TEST(ExplicitPermutation, equality) {
 	ASSERT_EQ(p1, p4);
 }
 
+TEST(ExplicitPermutation, hash) {
+	const perm::ExplicitPermutation p1({ 1, 2, 0, 3 });
+	const perm::ExplicitPermutation p2({ 1, 2, 0 });
+	const perm::ExplicitPermutation p3({ 1, 2, 0 }, -1);
+
+	// Trailing fixed points are irrelevant but the sign is not
+	ASSERT_EQ(p1.hash(), p2.hash());
+	ASSERT_NE(p1.hash(), p3.hash());
+
+	// Copies have the same hash but are otherwise independent
+	perm::ExplicitPermutation copy = p1;
+	ASSERT_EQ(copy.hash(), p1.hash());
+	copy.shift(1);
+	ASSERT_NE(copy.hash(), p1.hash());
+	ASSERT_EQ(copy.hash(), perm::ExplicitPermutation({ 0, 2, 3, 1 }).hash());
+
+	std::unordered_map< perm::Permutation, int > map;
+	map[perm::Permutation(p1)] = 1;
+	map[perm::Permutation(p3)] = 3;
+
+	ASSERT_EQ(map.size(), 2);
+	ASSERT_EQ(map.at(perm::Permutation(p2)), 1);
+	ASSERT_EQ(map.at(perm::Permutation(p3)), 3);
+	ASSERT_EQ(std::hash< perm::Permutation >{}(p2), p2.hash());
+}
+
+TEST(ExplicitPermutation, ordering) {
+	// Long images with their first difference at various positions (in and after the first blocks of points)
+	std::vector< perm::Permutation > perms;
+	for (perm::AbstractPermutation::value_type i = 0; i < 20; ++i) {
+		std::vector< perm::AbstractPermutation::value_type > image(30);
+		for (perm::AbstractPermutation::value_type j = 0; j < 30; ++j) {
+			image[j] = j;
+		}
+		std::reverse(image.begin() + i, image.end());
+
+		perms.push_back(perm::ExplicitPermutation(image));
+	}
+
+	std::vector< perm::Permutation > sorted = perms;
+	std::sort(sorted.begin(), sorted.end());
+
+	// Reversing a longer suffix makes the permutation bigger, as the first changed point gets mapped to a bigger value
+	ASSERT_TRUE(std::equal(perms.rbegin(), perms.rend(), sorted.begin()));
+
+	for (const perm::Permutation &currentPerm : perms) {
+		ASSERT_TRUE(std::binary_search(sorted.begin(), sorted.end(), currentPerm));
+	}
+	ASSERT_FALSE(std::binary_search(sorted.begin(), sorted.end(), perm::Permutation(perm::ExplicitPermutation(-1))));
+
+	const std::set< perm::ExplicitPermutation > set = {
+		perm::ExplicitPermutation({ 1, 0 }),
+		perm::ExplicitPermutation({ 1, 0, 2 }),
+		perm::ExplicitPermutation({ 1, 0 }, -1),
+	};
+	ASSERT_EQ(set.size(), 2);
+	ASSERT_EQ(set.begin()->sign(), -1);
+}
+
 TEST(ExplicitPermutation, preMultiply) {
 	perm::ExplicitPermutation id;
 	perm::ExplicitPermutation p1 = perm::ExplicitPermutation(perm::Cycle({ 1, 2, 3 }));
@@ -111,6 +178,98 @@ TEST(ExplicitPermutation, binary_multiply_operator) {
 	ASSERT_EQ(p1Abstract * p2, r1);
 }
 
+TEST(ExplicitPermutation, moveSemantics) {
+	perm::ExplicitPermutation p1(perm::Cycle({ 0, 5, 3 }), -1);
+	perm::ExplicitPermutation p2(perm::Cycle({ 1, 2 }));
+
+	const perm::AbstractPermutation::value_type *p1Image = p1.image().data();
+
+	// Move assignment takes over the memory of the moved-from object, which keeps a valid permutation
+	p2 = std::move(p1);
+	ASSERT_EQ(p2, perm::ExplicitPermutation(perm::Cycle({ 0, 5, 3 }), -1));
+	ASSERT_EQ(p2.image().data(), p1Image);
+	ASSERT_EQ(p1, perm::ExplicitPermutation(perm::Cycle({ 1, 2 })));
+
+	// Multiplying a temporary reuses its memory
+	perm::ExplicitPermutation temporary(perm::Cycle({ 2, 7 }));
+	const perm::AbstractPermutation::value_type *temporaryImage = temporary.image().data();
+	const perm::ExplicitPermutation product = std::move(temporary) * p2;
+	ASSERT_EQ(product, perm::ExplicitPermutation(perm::Cycle({ 2, 7 })) * p2);
+	ASSERT_EQ(product.image().data(), temporaryImage);
+
+	// Composing into an object with sufficient capacity doesn't reallocate
+	perm::ExplicitPermutation destination(perm::Cycle({ 0, 9 }));
+	const perm::AbstractPermutation::value_type *destinationImage = destination.image().data();
+	perm::composeInto(destination, p2, product);
+	ASSERT_EQ(destination, p2 * product);
+	perm::invertInto(destination, p2);
+	ASSERT_EQ(destination.image().data(), destinationImage);
+}
+
+TEST(ExplicitPermutation, memoryResource) {
+	CountingMemoryResource resource;
+
+	{
+		perm::ExplicitPermutation p1(perm::Cycle({ 0, 5, 3 }), -1, &resource);
+		ASSERT_EQ(p1.get_allocator().resource(), &resource);
+		ASSERT_EQ(p1, perm::ExplicitPermutation(perm::Cycle({ 0, 5, 3 }), -1));
+		ASSERT_GT(resource.allocations(), 0);
+
+		const perm::ExplicitPermutation p2(perm::Cycle({ 1, 2 }));
+		perm::ExplicitPermutation p3(p2, &resource);
+		ASSERT_EQ(p3.get_allocator().resource(), &resource);
+		ASSERT_EQ(p3, p2);
+
+		// Plain copies use the default resource, just as the standard containers do
+		const perm::ExplicitPermutation copy = p1;
+		ASSERT_EQ(copy.get_allocator().resource(), perm::pmr::get_default_resource());
+
+		// Products keep the resource of the permutation they are computed in
+		p3.postMultiply(p1);
+		ASSERT_EQ(p3.get_allocator().resource(), &resource);
+		ASSERT_EQ(p3, p2 * copy);
+
+		// Moving between different resources copies the images
+		perm::ExplicitPermutation other(perm::Cycle({ 4, 7 }));
+		other = std::move(p1);
+		ASSERT_EQ(other.get_allocator().resource(), perm::pmr::get_default_resource());
+		ASSERT_EQ(other, copy);
+
+		const perm::ExplicitPermutation p4 = perm::power(p2, 3, &resource);
+		ASSERT_EQ(p4.get_allocator().resource(), &resource);
+		ASSERT_EQ(p4, p2);
+	}
+
+	ASSERT_EQ(resource.liveAllocations(), 0);
+}
+
+TEST(ExplicitPermutation, power) {
+	const perm::ExplicitPermutation p(perm::Cycle({ { 0, 1, 2 }, { 3, 4 }, { 5, 6, 7, 8, 9 } }), -1);
+
+	perm::ExplicitPermutation expected(+1);
+	for (std::int64_t k = 0; k <= 31; ++k) {
+		ASSERT_EQ(perm::power(p, k), expected) << "k = " << k;
+
+		perm::ExplicitPermutation inverse = expected;
+		inverse.invert();
+		ASSERT_EQ(perm::power(p, -k), inverse) << "k = " << -k;
+
+		expected.postMultiply(p);
+	}
+
+	// lcm(3, 2, 5) = 30 is even, so the sign doesn't affect the order
+	ASSERT_EQ(perm::order(p), 30);
+	ASSERT_TRUE(perm::power(p, 30).isIdentity());
+	ASSERT_EQ(perm::power(p, 30000000000), perm::ExplicitPermutation());
+	ASSERT_EQ(perm::power(p, 30000000001), p);
+
+	ASSERT_EQ(perm::order(perm::ExplicitPermutation()), 1);
+	ASSERT_EQ(perm::order(perm::ExplicitPermutation(-1)), 2);
+	ASSERT_EQ(perm::order(perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 }))), 3);
+	ASSERT_EQ(perm::order(perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 }), -1)), 6);
+	ASSERT_EQ(perm::order(perm::ExplicitPermutation(perm::Cycle({ { 0, 1 }, { 2, 3, 4, 5 } }), -1)), 4);
+}
+
 struct MultiplicationTest : ::testing::TestWithParam< std::tuple< perm::Cycle, perm::Cycle > > {};
 
 TEST_P(MultiplicationTest, consistency) {
@@ -137,6 +296,20 @@ TEST_P(MultiplicationTest, consistency) {
 	ASSERT_EQ(preMultipliedSelf, p1 * p1);
 
 
+	perm::ExplicitPermutation composed(perm::Cycle({ 7, 8 }), -1);
+	perm::composeInto(composed, p1, p2);
+	ASSERT_EQ(composed, p1 * p2);
+
+	perm::composeInto(composed, composed, p1);
+	ASSERT_EQ(composed, p1 * p2 * p1);
+
+	perm::composeInto(composed, p2, composed);
+	ASSERT_EQ(composed, p2 * p1 * p2 * p1);
+
+	perm::composeInto(composed, p1, p1);
+	ASSERT_EQ(composed, p1 * p1);
+
+
 	perm::ExplicitPermutation p1Inv = p1;
 	p1Inv.invert();
 
@@ -173,6 +346,10 @@ TEST_P(InvertTest, invert) {
 	perm.invert();
 	ASSERT_EQ(perm, expectedInverse);
 
+	perm::ExplicitPermutation inverted(perm::Cycle({ 3, 9 }), -1);
+	perm::invertInto(inverted, original);
+	ASSERT_EQ(inverted, expectedInverse);
+
 	// perm times its inverse should be identity
 	ASSERT_EQ(original * perm, identity);
 
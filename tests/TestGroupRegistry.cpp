@@ -0,0 +1,80 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/Cycle.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/GroupRegistry.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/PrimitivePermutationGroup.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(GroupRegistry, interning) {
+	perm::GroupRegistry registry;
+
+	const perm::ExplicitPermutation cycle(perm::Cycle({ 0, 1, 2, 3 }), -1);
+	const perm::ExplicitPermutation transposition(perm::Cycle({ 0, 1 }), -1);
+
+	std::shared_ptr< const perm::PrimitivePermutationGroup > group = registry.get({ cycle, transposition });
+
+	ASSERT_EQ(group->order(), 24);
+	ASSERT_EQ(*group, perm::PrimitivePermutationGroup({ cycle, transposition }));
+	ASSERT_EQ(registry.statistics().misses, 1);
+	ASSERT_EQ(registry.statistics().hits, 0);
+	ASSERT_EQ(registry.statistics().groups, 1);
+	ASSERT_GT(registry.statistics().memory, 0);
+
+	// Order, duplicates and identities don't matter
+	ASSERT_EQ(registry.get({ transposition, perm::ExplicitPermutation(), cycle, transposition }), group);
+	ASSERT_EQ(registry.statistics().hits, 1);
+
+	// The sign is part of the generator's identity
+	std::shared_ptr< const perm::PrimitivePermutationGroup > unsignedGroup =
+		registry.get({ cycle, perm::ExplicitPermutation(perm::Cycle({ 0, 1 })) });
+	ASSERT_NE(unsignedGroup, group);
+	ASSERT_EQ(registry.statistics().misses, 2);
+	ASSERT_EQ(registry.statistics().groups, 2);
+
+	ASSERT_EQ(registry.get({})->order(), 1);
+	ASSERT_EQ(registry.get({ perm::ExplicitPermutation() }), registry.get({}));
+
+	registry.clear();
+	ASSERT_EQ(registry.statistics().groups, 0);
+	ASSERT_EQ(registry.statistics().memory, 0);
+
+	// Groups handed out before clearing stay valid
+	ASSERT_EQ(group->order(), 24);
+	ASSERT_NE(registry.get({ cycle, transposition }), group);
+}
+
+TEST(GroupRegistry, concurrentRequests) {
+	perm::GroupRegistry registry;
+
+	const std::vector< perm::Permutation > generators = { perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3, 4 })),
+														  perm::ExplicitPermutation(perm::Cycle({ 0, 1 })) };
+
+	std::vector< std::shared_ptr< const perm::PrimitivePermutationGroup > > groups(8);
+	std::vector< std::thread > threads;
+
+	for (std::size_t i = 0; i < groups.size(); ++i) {
+		threads.emplace_back([&, i]() { groups[i] = registry.get(generators); });
+	}
+
+	for (std::thread &currentThread : threads) {
+		currentThread.join();
+	}
+
+	for (const std::shared_ptr< const perm::PrimitivePermutationGroup > &currentGroup : groups) {
+		ASSERT_EQ(currentGroup, groups[0]);
+	}
+
+	ASSERT_EQ(groups[0]->order(), 120);
+	ASSERT_EQ(registry.statistics().misses, 1);
+	ASSERT_EQ(registry.statistics().hits, groups.size() - 1);
+}
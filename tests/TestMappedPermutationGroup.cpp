@@ -0,0 +1,226 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/Cycle.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/MappedPermutationGroup.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/PrimitivePermutationGroup.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static std::vector< std::uint64_t > toAlignedBuffer(const std::string &data) {
+	std::vector< std::uint64_t > buffer((data.size() + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+	std::memcpy(buffer.data(), data.data(), data.size());
+
+	return buffer;
+}
+
+static void compareGroups(const perm::AbstractPermutationGroup &expected, const perm::MappedPermutationGroup &actual) {
+	ASSERT_EQ(actual.order(), expected.order());
+	ASSERT_EQ(actual.getGenerators(), expected.getGenerators());
+
+	// The element table is sorted in the order established by compare()
+	std::vector< perm::Permutation > expectedElements;
+	std::vector< perm::Permutation > actualElements;
+	expected.getElementsTo(expectedElements);
+	actual.getElementsTo(actualElements);
+	std::sort(expectedElements.begin(), expectedElements.end(),
+			  [](const perm::Permutation &lhs, const perm::Permutation &rhs) {
+				  return perm::compare(lhs.get(), rhs.get()) < 0;
+			  });
+	ASSERT_EQ(actualElements, expectedElements);
+
+	for (const perm::Permutation &currentElement : expectedElements) {
+		ASSERT_TRUE(actual.contains(currentElement.get()));
+	}
+
+	// The rank of an element is its position in the element table
+	for (std::size_t i = 0; i < expectedElements.size(); ++i) {
+		ASSERT_EQ(actual.rank(expectedElements[i].get()), i);
+		ASSERT_EQ(actual.unrank(i), expectedElements[i]);
+	}
+
+	for (perm::AbstractPermutation::value_type i = 0; i < 8; ++i) {
+		std::vector< perm::AbstractPermutation::value_type > expectedOrbit = expected.orbit(i);
+		std::vector< perm::AbstractPermutation::value_type > actualOrbit   = actual.orbit(i);
+		std::sort(expectedOrbit.begin(), expectedOrbit.end());
+		std::sort(actualOrbit.begin(), actualOrbit.end());
+
+		ASSERT_EQ(actualOrbit, expectedOrbit) << "Orbit of " << i;
+	}
+
+	const std::vector< perm::Permutation > probes = {
+		perm::ExplicitPermutation(perm::Cycle({ 4, 5 })),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 6, 2 }), -1),
+		perm::ExplicitPermutation(perm::Cycle({ 1, 3, 5, 7 })),
+		perm::ExplicitPermutation(perm::Cycle({ 1, 2 })),
+	};
+
+	for (const perm::Permutation &currentProbe : probes) {
+		ASSERT_EQ(actual.leftCosetRepresentative(currentProbe.get()),
+				  expected.leftCosetRepresentative(currentProbe.get()));
+		ASSERT_EQ(actual.rightCosetRepresentative(currentProbe.get()),
+				  expected.rightCosetRepresentative(currentProbe.get()));
+	}
+}
+
+TEST(MappedPermutationGroup, fromBuffer) {
+	const perm::PrimitivePermutationGroup group({
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3 }), -1),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1),
+	});
+
+	std::stringstream stream;
+	ASSERT_TRUE(perm::MappedPermutationGroup::write(group, stream));
+
+	const std::string data                    = stream.str();
+	const std::vector< std::uint64_t > buffer = toAlignedBuffer(data);
+
+	std::optional< perm::MappedPermutationGroup > mapped =
+		perm::MappedPermutationGroup::fromBuffer(buffer.data(), data.size());
+	ASSERT_TRUE(mapped.has_value());
+	ASSERT_EQ(mapped->degree(), 4);
+
+	compareGroups(group, *mapped);
+
+	ASSERT_FALSE(mapped->contains(perm::ExplicitPermutation(perm::Cycle({ 0, 1 }))));
+	ASSERT_FALSE(mapped->contains(perm::ExplicitPermutation(perm::Cycle({ 0, 4 }), -1)));
+
+	// The generators can't be changed, but contained elements are accepted
+	ASSERT_FALSE(mapped->addGenerator(perm::ExplicitPermutation(perm::Cycle({ 0, 2 }), -1)));
+	mapped->setGenerators({ perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1) });
+	ASSERT_THROW(mapped->addGenerator(perm::ExplicitPermutation(perm::Cycle({ 0, 1 }))), std::invalid_argument);
+	ASSERT_THROW(mapped->setGenerators({ perm::ExplicitPermutation(perm::Cycle({ 4, 5 })) }), std::invalid_argument);
+	ASSERT_EQ(mapped->order(), 24);
+}
+
+TEST(MappedPermutationGroup, negativeIdentity) {
+	// Coset representatives have to prefer the negative sign for equal images, just like compare() does
+	const perm::PrimitivePermutationGroup group({
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1),
+	});
+
+	std::stringstream stream;
+	ASSERT_TRUE(perm::MappedPermutationGroup::write(group, stream));
+
+	const std::string data                    = stream.str();
+	const std::vector< std::uint64_t > buffer = toAlignedBuffer(data);
+
+	std::optional< perm::MappedPermutationGroup > mapped =
+		perm::MappedPermutationGroup::fromBuffer(buffer.data(), data.size());
+	ASSERT_TRUE(mapped.has_value());
+
+	compareGroups(group, *mapped);
+
+	const perm::ExplicitPermutation transposition(perm::Cycle({ 1, 2 }));
+	ASSERT_EQ(mapped->leftCosetRepresentative(transposition), perm::ExplicitPermutation(perm::Cycle({ 1, 2 }), -1));
+	ASSERT_EQ(mapped->rightCosetRepresentative(transposition), perm::ExplicitPermutation(perm::Cycle({ 1, 2 }), -1));
+}
+
+TEST(MappedPermutationGroup, open) {
+	const perm::PrimitivePermutationGroup group({
+		perm::ExplicitPermutation(perm::Cycle({ 0, 2, 4, 6 })),
+		perm::ExplicitPermutation(perm::Cycle({ 1, 7 }), -1),
+	});
+
+	const std::string path = ::testing::TempDir() + "libperm_mapped_group.bin";
+
+	{
+		std::ofstream file(path, std::ios::binary);
+		ASSERT_TRUE(perm::MappedPermutationGroup::write(group, file));
+	}
+
+	{
+		std::optional< perm::MappedPermutationGroup > mapped = perm::MappedPermutationGroup::open(path);
+		ASSERT_TRUE(mapped.has_value());
+
+		compareGroups(group, *mapped);
+	}
+
+	std::remove(path.c_str());
+
+	ASSERT_FALSE(perm::MappedPermutationGroup::open(path).has_value());
+}
+
+TEST(MappedPermutationGroup, invalidData) {
+	const perm::PrimitivePermutationGroup group({ perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 })) });
+
+	std::stringstream stream;
+	ASSERT_TRUE(perm::MappedPermutationGroup::write(group, stream));
+
+	const std::string data = stream.str();
+
+	// Truncated data
+	std::vector< std::uint64_t > buffer = toAlignedBuffer(data);
+	ASSERT_FALSE(perm::MappedPermutationGroup::fromBuffer(buffer.data(), data.size() - 1).has_value());
+
+	// Wrong magic
+	std::string corrupted = data;
+	corrupted[0]          = 'X';
+	buffer                = toAlignedBuffer(corrupted);
+	ASSERT_FALSE(perm::MappedPermutationGroup::fromBuffer(buffer.data(), corrupted.size()).has_value());
+
+	// Unknown version
+	corrupted                   = data;
+	const std::uint32_t version = perm::MappedPermutationGroup::formatVersion + 1;
+	std::memcpy(corrupted.data() + 8, &version, sizeof(version));
+	buffer = toAlignedBuffer(corrupted);
+	ASSERT_FALSE(perm::MappedPermutationGroup::fromBuffer(buffer.data(), corrupted.size()).has_value());
+
+	// Header offsets that would overflow when computing the section sizes
+	const std::uint64_t hugeOrder = std::numeric_limits< std::uint64_t >::max() / 2;
+	corrupted                     = data;
+	std::memcpy(corrupted.data() + 40, &hugeOrder, sizeof(hugeOrder));
+	buffer = toAlignedBuffer(corrupted);
+	ASSERT_FALSE(perm::MappedPermutationGroup::fromBuffer(buffer.data(), corrupted.size()).has_value());
+
+	std::uint64_t elementOffset;
+	std::memcpy(&elementOffset, data.data() + 64, sizeof(elementOffset));
+	const std::size_t firstImage = static_cast< std::size_t >(elementOffset);
+
+	// Images that aren't valid points
+	corrupted             = data;
+	corrupted[firstImage] = static_cast< char >(0xFF);
+	buffer                = toAlignedBuffer(corrupted);
+	ASSERT_FALSE(perm::MappedPermutationGroup::fromBuffer(buffer.data(), corrupted.size()).has_value());
+
+	// Rows that aren't bijections
+	corrupted                 = data;
+	corrupted[firstImage + 1] = corrupted[firstImage];
+	buffer                    = toAlignedBuffer(corrupted);
+	ASSERT_FALSE(perm::MappedPermutationGroup::fromBuffer(buffer.data(), corrupted.size()).has_value());
+
+	// Element tables that aren't sorted (the rows of this group consist of 3 single-byte points each)
+	corrupted = data;
+	std::swap_ranges(corrupted.begin() + firstImage, corrupted.begin() + firstImage + 3,
+					 corrupted.begin() + firstImage + 3);
+	buffer = toAlignedBuffer(corrupted);
+	ASSERT_FALSE(perm::MappedPermutationGroup::fromBuffer(buffer.data(), corrupted.size()).has_value());
+
+	// The unmodified data is accepted
+	buffer = toAlignedBuffer(data);
+	ASSERT_TRUE(perm::MappedPermutationGroup::fromBuffer(buffer.data(), data.size()).has_value());
+
+	// Misaligned buffer
+	std::vector< std::uint64_t > misaligned(buffer.size() + 1);
+	std::memcpy(reinterpret_cast< char * >(misaligned.data()) + 1, data.data(), data.size());
+	ASSERT_FALSE(
+		perm::MappedPermutationGroup::fromBuffer(reinterpret_cast< char * >(misaligned.data()) + 1, data.size())
+			.has_value());
+}
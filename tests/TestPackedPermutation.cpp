@@ -0,0 +1,159 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/PackedPermutation.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/PrimitivePermutationGroup.hpp>
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+TEST(PackedPermutation, construction) {
+	perm::PackedPermutation perm;
+
+	ASSERT_EQ(perm.maxElement(), static_cast< perm::AbstractPermutation::value_type >(0));
+	ASSERT_EQ(perm.packedImage(), perm::PackedPermutation::identity_image);
+	ASSERT_TRUE(perm.isIdentity());
+	ASSERT_EQ(perm.sign(), 1);
+
+	perm = perm::PackedPermutation(-1);
+	ASSERT_TRUE(!perm.isIdentity());
+	ASSERT_EQ(perm.sign(), -1);
+
+	perm = perm::PackedPermutation(std::vector< perm::AbstractPermutation::value_type >{ 1, 2, 0 });
+	ASSERT_EQ(perm.packedImage(), 0xFEDCBA9876543021);
+	ASSERT_EQ(perm.maxElement(), static_cast< perm::AbstractPermutation::value_type >(2));
+	ASSERT_EQ(perm.image(0), static_cast< perm::AbstractPermutation::value_type >(1));
+	ASSERT_EQ(perm.image(3), static_cast< perm::AbstractPermutation::value_type >(3));
+	ASSERT_EQ(perm.image(100), static_cast< perm::AbstractPermutation::value_type >(100));
+
+	perm = perm::PackedPermutation(perm::Cycle({ 0, 15 }));
+	ASSERT_EQ(perm.packedImage(), 0x0EDCBA987654321F);
+	ASSERT_EQ(perm.maxElement(), static_cast< perm::AbstractPermutation::value_type >(15));
+
+	ASSERT_EQ(perm::PackedPermutation::fromPackedImage(0x0EDCBA987654321F, -1),
+			  perm::ExplicitPermutation(perm::Cycle({ 0, 15 }), -1));
+
+	const perm::ExplicitPermutation explicitPerm(perm::Cycle({ { 2, 5 }, { 8, 9 } }), -1);
+	perm = perm::PackedPermutation(explicitPerm);
+	ASSERT_EQ(perm.sign(), -1);
+	ASSERT_EQ(perm, explicitPerm);
+	ASSERT_EQ(explicitPerm, perm);
+	ASSERT_EQ(perm.hash(), explicitPerm.hash());
+}
+
+TEST(PackedPermutation, multiply) {
+	const perm::PackedPermutation p1(perm::Cycle({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }));
+	const perm::PackedPermutation p2(perm::Cycle({ { 0, 15 }, { 3, 7, 11 } }), -1);
+
+	const perm::ExplicitPermutation explicit1(p1.toCycle());
+	const perm::ExplicitPermutation explicit2(p2.toCycle(), -1);
+
+	// Apply p1 first, then p2
+	perm::PackedPermutation product = p1;
+	product.postMultiply(p2);
+	ASSERT_EQ(product, explicit1 * explicit2);
+
+	// Apply p2 first, then p1
+	product = p1;
+	product.preMultiply(p2);
+	ASSERT_EQ(product, explicit2 * explicit1);
+
+	// Mixed representations
+	product = p1;
+	product.postMultiply(explicit2);
+	ASSERT_EQ(product, explicit1 * explicit2);
+
+	product.preMultiply(explicit1);
+	ASSERT_EQ(product, explicit1 * explicit1 * explicit2);
+
+	product = p2;
+	product.postMultiply(product);
+	ASSERT_EQ(product, perm::PackedPermutation(perm::Cycle({ 3, 11, 7 })));
+}
+
+TEST(PackedPermutation, invert) {
+	perm::PackedPermutation perm(perm::Cycle({ { 4, 15, 12 }, { 1, 3 } }), -1);
+
+	perm.invert();
+
+	ASSERT_EQ(perm, perm::PackedPermutation(perm::Cycle({ { 12, 15, 4 }, { 1, 3 } }), -1));
+
+	perm.postMultiply(perm::PackedPermutation(perm::Cycle({ { 4, 15, 12 }, { 1, 3 } }), -1));
+	ASSERT_TRUE(perm.isIdentity());
+}
+
+TEST(PackedPermutation, shift) {
+	perm::PackedPermutation perm(perm::Cycle({ { 1, 3 }, { 5, 10 } }));
+
+	perm.shift(5, 4);
+	ASSERT_EQ(perm, perm::PackedPermutation(perm::Cycle({ { 1, 3 }, { 10, 15 } })));
+
+	perm.shift(-1);
+	ASSERT_EQ(perm, perm::PackedPermutation(perm::Cycle({ { 0, 2 }, { 9, 14 } })));
+}
+
+TEST(PackedPermutation, outOfRange) {
+	// Fixed points beyond 15 don't need to be represented
+	std::vector< perm::AbstractPermutation::value_type > image(20);
+	std::iota(image.begin(), image.end(), 0);
+	std::swap(image[0], image[1]);
+	ASSERT_EQ(perm::PackedPermutation(image), perm::PackedPermutation(perm::Cycle({ 0, 1 })));
+
+	std::swap(image[3], image[17]);
+	EXPECT_THROW(perm::PackedPermutation{ image }, std::out_of_range);
+	EXPECT_THROW(perm::PackedPermutation(perm::Cycle({ 3, 20 })), std::out_of_range);
+	EXPECT_THROW(perm::PackedPermutation(perm::ExplicitPermutation(perm::Cycle({ 3, 20 }))), std::out_of_range);
+
+	// Failing operations leave the permutation unchanged
+	const perm::PackedPermutation original(perm::Cycle({ 0, 1 }));
+	perm::PackedPermutation perm = original;
+
+	EXPECT_THROW(perm.postMultiply(perm::ExplicitPermutation(perm::Cycle({ 3, 20 }), -1)), std::out_of_range);
+	ASSERT_EQ(perm, original);
+	EXPECT_THROW(perm.preMultiply(perm::ExplicitPermutation(perm::Cycle({ 3, 20 }), -1)), std::out_of_range);
+	ASSERT_EQ(perm, original);
+
+	EXPECT_THROW(perm.shift(15), std::out_of_range);
+	ASSERT_EQ(perm, original);
+
+	perm.shift(14);
+	ASSERT_EQ(perm, perm::PackedPermutation(perm::Cycle({ 14, 15 })));
+}
+
+TEST(PackedPermutation, toCycle) {
+	const perm::Cycle cycle({ { 3, 14, 7 }, { 8, 9 } });
+	const perm::PackedPermutation perm(cycle);
+
+	ASSERT_EQ(perm.toCycle(), cycle);
+	ASSERT_EQ(perm.toString(), "+( 3 14 7 )( 8 9 )");
+}
+
+TEST(PackedPermutation, group) {
+	// The symmetric group of degree 6 generated with packed permutations
+	const perm::PrimitivePermutationGroup packedGroup({ perm::PackedPermutation(perm::Cycle({ 0, 1, 2, 3, 4, 5 })),
+														perm::PackedPermutation(perm::Cycle({ 0, 1 })) });
+	const perm::PrimitivePermutationGroup explicitGroup({ perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3, 4, 5 })),
+														  perm::ExplicitPermutation(perm::Cycle({ 0, 1 })) });
+
+	ASSERT_EQ(packedGroup.order(), 720);
+	ASSERT_EQ(packedGroup, explicitGroup);
+	ASSERT_TRUE(packedGroup.contains(perm::PackedPermutation(perm::Cycle({ { 1, 4 }, { 2, 3, 5 } }))));
+}
+
+TEST(PackedPermutation, variant) {
+	perm::Permutation perm = perm::PackedPermutation(perm::Cycle({ 6, 11 }));
+
+	perm->postMultiply(perm::ExplicitPermutation(perm::Cycle({ 6, 11 })));
+	ASSERT_TRUE(perm->isIdentity());
+
+	ASSERT_EQ(std::hash< perm::Permutation >{}(perm), std::hash< perm::Permutation >{}(perm::ExplicitPermutation()));
+}
@@ -5,6 +5,7 @@
 
 #include <libperm/AbstractPermutationGroup.hpp>
 #include <libperm/Cycle.hpp>
+#include <libperm/DirectProductGroup.hpp>
 #include <libperm/ExplicitPermutation.hpp>
 #include <libperm/Permutation.hpp>
 #include <libperm/PrimitivePermutationGroup.hpp>
@@ -15,7 +16,7 @@
 #include <vector>
 
 
-using PermutationGroupTypes = ::testing::Types< perm::PrimitivePermutationGroup >;
+using PermutationGroupTypes = ::testing::Types< perm::PrimitivePermutationGroup, perm::DirectProductGroup >;
 
 
 template< typename Group > Group fromGenerators(const std::vector< perm::Cycle > &cycles) {
@@ -149,6 +150,29 @@ TYPED_TEST(PermutationGroupInterface, orbit) {
 }
 
 
+TYPED_TEST(PermutationGroupInterface, orbits) {
+	using Group = TypeParam;
+
+	const Group g = fromGenerators< Group >({ perm::Cycle({ 6, 1 }), perm::Cycle({ 3, 5, 2 }), perm::Cycle({ 1, 4 }) });
+	const perm::AbstractPermutationGroup &group = g;
+
+	const std::vector< std::vector< perm::AbstractPermutation::value_type > > expectedOrbits = {
+		{ 0 },
+		{ 1, 4, 6 },
+		{ 2, 3, 5 },
+	};
+	ASSERT_EQ(group.orbits(), expectedOrbits);
+
+	for (const std::vector< perm::AbstractPermutation::value_type > &currentOrbit : expectedOrbits) {
+		for (perm::AbstractPermutation::value_type currentPoint : currentOrbit) {
+			ASSERT_THAT(group.orbit(currentPoint), ::testing::UnorderedElementsAreArray(currentOrbit));
+		}
+	}
+
+	ASSERT_TRUE(Group().orbits().empty());
+}
+
+
 TYPED_TEST(PermutationGroupInterface, order) {
 	using Group = TypeParam;
 
@@ -184,6 +208,46 @@ TYPED_TEST(PermutationGroupInterface, contains) {
 }
 
 
+TYPED_TEST(PermutationGroupInterface, rank) {
+	using Group = TypeParam;
+
+	const Group g = fromGenerators< Group >({ perm::Cycle({ 0, 1, 2 }), perm::Cycle({ 4, 5 }) });
+	const perm::AbstractPermutationGroup &group = g;
+
+	std::vector< perm::Permutation > elements;
+	group.getElementsTo(elements);
+
+	// The ranks have to be a bijection onto 0, ..., |G| - 1
+	std::vector< bool > seen(group.order(), false);
+	for (const perm::Permutation &currentElement : elements) {
+		const std::size_t rank = group.rank(currentElement.get());
+
+		ASSERT_LT(rank, group.order());
+		ASSERT_FALSE(seen[rank]);
+		seen[rank] = true;
+
+		ASSERT_EQ(group.unrank(rank), currentElement);
+	}
+
+	ASSERT_EQ(group.rank(perm::ExplicitPermutation(perm::Cycle({ 0, 1 }))), group.order());
+	ASSERT_EQ(group.rank(perm::ExplicitPermutation(perm::Cycle({ 4, 5 }), -1)), group.order());
+
+	// Independent blocks that both contain the negative identity
+	const Group signedGroup({ perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1),
+							  perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+							  perm::ExplicitPermutation(perm::Cycle({ 4, 5 }), -1),
+							  perm::ExplicitPermutation(perm::Cycle({ 4, 5 })) });
+	ASSERT_EQ(signedGroup.order(), 8);
+
+	for (std::size_t rank = 0; rank < signedGroup.order(); ++rank) {
+		const perm::Permutation element = signedGroup.unrank(rank);
+
+		ASSERT_TRUE(signedGroup.contains(element.get())) << "Element: " << element;
+		ASSERT_EQ(signedGroup.rank(element.get()), rank) << "Element: " << element;
+	}
+}
+
+
 TYPED_TEST(PermutationGroupInterface, setGenerators) {
 	using Group = TypeParam;
 
@@ -6,13 +6,19 @@
 #include <libperm/AbstractPermutation.hpp>
 #include <libperm/Cycle.hpp>
 #include <libperm/ExplicitPermutation.hpp>
+#include <libperm/PackedPermutation.hpp>
+#include <libperm/SparsePermutation.hpp>
 
 #include <gtest/gtest.h>
 
+#include <functional>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 
-using PermutationTypes = ::testing::Types< perm::ExplicitPermutation >;
+using PermutationTypes =
+	::testing::Types< perm::ExplicitPermutation, perm::SparsePermutation, perm::PackedPermutation >;
 
 
 template< typename T > struct PermCtor {
@@ -61,6 +67,98 @@ TYPED_TEST(PermutationInterface, equality) {
 }
 
 
+TYPED_TEST(PermutationInterface, hash) {
+	using Perm = TypeParam;
+
+	std::vector< perm::Cycle > cycles = {
+		perm::Cycle(),
+		perm::Cycle({ 1, 2 }),
+		perm::Cycle({ 0, 2, 1 }),
+		perm::Cycle({ { 0, 3, 5 }, { 2, 4, 1 } }),
+	};
+
+	std::unordered_set< Perm > set;
+
+	for (const perm::Cycle &currentCycle : cycles) {
+		Perm p                                = PermCtor< Perm >::construct(currentCycle);
+		const perm::AbstractPermutation &perm = p;
+
+		// Implementations may specialize the hash function but the result must be consistent with the generic one
+		ASSERT_EQ(perm.hash(), perm.AbstractPermutation::hash());
+		ASSERT_EQ(std::hash< Perm >{}(p), std::hash< perm::AbstractPermutation >{}(perm));
+		ASSERT_EQ(perm.hash(), PermCtor< Perm >::construct(currentCycle).hash());
+
+		ASSERT_TRUE(set.insert(p).second);
+		ASSERT_FALSE(set.insert(p).second);
+
+		if constexpr (Perm::is_signed) {
+			const std::size_t positiveHash = perm.hash();
+			p.setSign(-1);
+
+			ASSERT_NE(perm.hash(), positiveHash);
+			ASSERT_EQ(perm.hash(), perm.AbstractPermutation::hash());
+			ASSERT_TRUE(set.insert(p).second);
+		}
+	}
+
+	// Changing a permutation must also change its hash
+	Perm p                                = PermCtor< Perm >::construct(perm::Cycle({ 0, 2, 1 }));
+	const perm::AbstractPermutation &perm = p;
+	const std::size_t initialHash         = perm.hash();
+
+	p.invert();
+	ASSERT_NE(perm.hash(), initialHash);
+	ASSERT_EQ(perm.hash(), perm.AbstractPermutation::hash());
+
+	p.postMultiply(PermCtor< Perm >::construct(perm::Cycle({ 0, 2, 1 })));
+	ASSERT_TRUE(perm.isIdentity());
+	ASSERT_EQ(perm.hash(), PermCtor< Perm >::construct(perm::Cycle()).hash());
+}
+
+
+TYPED_TEST(PermutationInterface, ordering) {
+	using Perm = TypeParam;
+
+	// Ordered lexicographically by the images of 0, 1, 2, ...
+	std::vector< perm::Cycle > cycles = {
+		perm::Cycle(),
+		perm::Cycle({ 2, 3 }),
+		perm::Cycle({ { 2, 3 }, { 9, 10 } }),
+		perm::Cycle({ 1, 2 }),
+		perm::Cycle({ 0, 1 }),
+		perm::Cycle({ 0, 1, 2, 3, 4, 5, 6, 7 }),
+		perm::Cycle({ 0, 2, 1 }),
+	};
+
+	for (std::size_t i = 0; i < cycles.size(); ++i) {
+		for (std::size_t j = 0; j < cycles.size(); ++j) {
+			const Perm p1 = PermCtor< Perm >::construct(cycles[i]);
+			const Perm p2 = PermCtor< Perm >::construct(cycles[j]);
+
+			const perm::AbstractPermutation &perm1 = p1;
+			const perm::AbstractPermutation &perm2 = p2;
+
+			ASSERT_EQ(perm::compare(perm1, perm2) < 0, i < j) << cycles[i] << " vs. " << cycles[j];
+			ASSERT_EQ(perm::compare(perm1, perm2) == 0, i == j) << cycles[i] << " vs. " << cycles[j];
+			ASSERT_EQ(perm1 < perm2, i < j);
+			ASSERT_EQ(perm1 > perm2, i > j);
+			ASSERT_EQ(perm1 <= perm2, i <= j);
+			ASSERT_EQ(perm1 >= perm2, i >= j);
+		}
+	}
+
+	if constexpr (Perm::is_signed) {
+		// Permutations with equal images are ordered by their sign
+		Perm negative = PermCtor< Perm >::construct(perm::Cycle({ 1, 2 }));
+		negative.setSign(-1);
+		const Perm positive = PermCtor< Perm >::construct(perm::Cycle({ 1, 2 }));
+
+		ASSERT_LT(perm::compare(negative, positive), 0);
+		ASSERT_GT(perm::compare(positive, negative), 0);
+	}
+}
+
+
 TYPED_TEST(PermutationInterface, image) {
 	using Perm = TypeParam;
 
@@ -203,13 +301,22 @@ TYPED_TEST(PermutationInterface, shift) {
 	Perm expected = PermCtor< Perm >::construct(perm::Cycle({ 3, 4 }));
 	ASSERT_EQ(actual, expected);
 
-	actual = PermCtor< Perm >::construct(perm::Cycle({ { 0, 1 }, { 7, 3 } }));
-	actual.shift(15);
-	expected = PermCtor< Perm >::construct(perm::Cycle({ { 15, 16 }, { 22, 18 } }));
-	ASSERT_EQ(actual, expected);
+	if constexpr (!std::is_same_v< Perm, perm::PackedPermutation >) {
+		// Packed permutations can't act on points beyond 15
+		actual = PermCtor< Perm >::construct(perm::Cycle({ { 0, 1 }, { 7, 3 } }));
+		actual.shift(15);
+		expected = PermCtor< Perm >::construct(perm::Cycle({ { 15, 16 }, { 22, 18 } }));
+		ASSERT_EQ(actual, expected);
+
+		actual.shift(-7);
+		expected = PermCtor< Perm >::construct(perm::Cycle({ { 8, 9 }, { 15, 11 } }));
+		ASSERT_EQ(actual, expected);
+	}
 
-	actual.shift(-7);
-	expected = PermCtor< Perm >::construct(perm::Cycle({ { 8, 9 }, { 15, 11 } }));
+	// Image points that coincide with the newly introduced fixed points must still be shifted
+	actual = PermCtor< Perm >::construct(perm::Cycle({ 0, 2, 1 }));
+	actual.shift(2);
+	expected = PermCtor< Perm >::construct(perm::Cycle({ 2, 4, 3 }));
 	ASSERT_EQ(actual, expected);
 
 	actual = PermCtor< Perm >::construct(perm::Cycle());
@@ -0,0 +1,75 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/PermutationProduct.hpp>
+#include <libperm/SparsePermutation.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+TEST(PermutationProduct, evaluation) {
+	const perm::ExplicitPermutation a(perm::Cycle({ 0, 1, 2 }));
+	const perm::ExplicitPermutation b(perm::Cycle({ 2, 5 }), -1);
+	const perm::SparsePermutation c(perm::Cycle({ 1, 7 }));
+	const perm::ExplicitPermutation d(perm::Cycle({ { 0, 3 }, { 4, 6 } }), -1);
+
+	const perm::ExplicitPermutation expected = a * b * c * d;
+
+	const perm::PermutationProduct product = perm::lazyProduct(a, b, c) * d;
+	ASSERT_EQ(product.size(), static_cast< std::size_t >(4));
+	ASSERT_EQ(product.sign(), expected.sign());
+	ASSERT_GE(product.maxElement(), expected.maxElement());
+
+	for (perm::AbstractPermutation::value_type i = 0; i <= product.maxElement() + 1; ++i) {
+		ASSERT_EQ(product.image(i), expected.image(i)) << "i = " << i;
+	}
+
+	ASSERT_EQ(product.materialize(), expected);
+
+	// The destination's previous content is irrelevant
+	perm::ExplicitPermutation destination(perm::Cycle({ 10, 11 }));
+	product.materializeInto(destination);
+	ASSERT_EQ(destination, expected);
+
+	ASSERT_TRUE(perm::PermutationProduct().empty());
+	ASSERT_TRUE(perm::PermutationProduct().materialize().isIdentity());
+	ASSERT_TRUE(perm::lazyProduct(a, b, b, a, a).materialize().isIdentity());
+}
+
+TEST(PermutationWord, evaluation) {
+	const std::vector< perm::Permutation > generators = {
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3 })),
+		perm::SparsePermutation(perm::Cycle({ 3, 9 })),
+	};
+
+	perm::PermutationWord word(generators, { 1, 0 });
+	word.append(2).append(1);
+
+	ASSERT_EQ(word.letters(), (std::vector< std::size_t >{ 1, 0, 2, 1 }));
+	ASSERT_EQ(word.size(), static_cast< std::size_t >(4));
+
+	perm::ExplicitPermutation expected(generators[1]->toCycle());
+	expected.postMultiply(generators[0].get());
+	expected.postMultiply(generators[2].get());
+	expected.postMultiply(generators[1].get());
+
+	ASSERT_EQ(word.sign(), -1);
+	for (perm::AbstractPermutation::value_type i = 0; i <= word.maxElement() + 1; ++i) {
+		ASSERT_EQ(word.image(i), expected.image(i)) << "i = " << i;
+	}
+
+	ASSERT_EQ(word.materialize(), expected);
+
+	perm::ExplicitPermutation destination;
+	word.materializeInto(destination);
+	ASSERT_EQ(destination, expected);
+
+	ASSERT_TRUE(perm::PermutationWord(generators).materialize().isIdentity());
+	ASSERT_TRUE(perm::PermutationWord(generators, { 1, 1, 1, 1 }).materialize().isIdentity());
+}
@@ -0,0 +1,104 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/Cycle.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/PermutationView.hpp>
+#include <libperm/PrimitivePermutationGroup.hpp>
+#include <libperm/Utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST(PermutationView, viewing) {
+	// Images of two permutations stored back to back in a single buffer, including trailing fixed points
+	const std::vector< perm::AbstractPermutation::value_type > buffer = { 1, 2, 0, 3, 4, 0, 1, 4, 2, 3 };
+
+	const perm::PermutationView view1(buffer.data(), 5, -1);
+	const perm::PermutationView view2(buffer.data() + 5, 5);
+
+	const perm::ExplicitPermutation expected1(perm::Cycle({ 0, 1, 2 }), -1);
+	const perm::ExplicitPermutation expected2(perm::Cycle({ 2, 4, 3 }));
+
+	ASSERT_EQ(view1.maxElement(), expected1.maxElement());
+	ASSERT_EQ(view1.sign(), -1);
+	ASSERT_EQ(view1, expected1);
+	ASSERT_EQ(expected1, view1);
+	ASSERT_EQ(view1.hash(), expected1.hash());
+	ASSERT_EQ(perm::compare(view1, expected1), 0);
+	ASSERT_EQ(view1.toCycle(), expected1.toCycle());
+	ASSERT_EQ(view1.toString(), expected1.toString());
+
+	ASSERT_EQ(view2, expected2);
+	ASSERT_EQ(view2.hash(), expected2.hash());
+	ASSERT_NE(view1, view2);
+
+	const perm::PermutationView identity(buffer.data() + 3, 0);
+	ASSERT_TRUE(identity.isIdentity());
+	ASSERT_EQ(identity.hash(), perm::ExplicitPermutation().hash());
+	ASSERT_EQ(identity.contiguousImage(), nullptr);
+}
+
+TEST(PermutationView, inverseViewing) {
+	const std::vector< perm::AbstractPermutation::value_type > image = { 3, 0, 4, 1, 2, 5 };
+
+	const perm::InversePermutationView view(image, -1);
+
+	perm::ExplicitPermutation expected(image, -1);
+	expected.invert();
+
+	ASSERT_EQ(view.maxElement(), expected.maxElement());
+	ASSERT_EQ(view, expected);
+	ASSERT_EQ(expected, view);
+	ASSERT_EQ(view.hash(), expected.hash());
+	ASSERT_EQ(view.toCycle(), expected.toCycle());
+	ASSERT_EQ(view.image(10), static_cast< perm::AbstractPermutation::value_type >(10));
+}
+
+TEST(PermutationView, readOnly) {
+	const std::vector< perm::AbstractPermutation::value_type > image = { 1, 2, 0 };
+	perm::PermutationView view(image);
+	perm::InversePermutationView inverseView(image);
+
+	ASSERT_THROW(view.invert(), std::logic_error);
+	ASSERT_THROW(view.preMultiply(perm::ExplicitPermutation(perm::Cycle({ 0, 1 }))), std::logic_error);
+	ASSERT_THROW(view.postMultiply(perm::ExplicitPermutation(perm::Cycle({ 0, 1 }))), std::logic_error);
+	ASSERT_THROW(view.shift(1), std::logic_error);
+	ASSERT_THROW(inverseView.invert(), std::logic_error);
+	ASSERT_EQ(view, perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 })));
+
+	// Views of temporary buffers would dangle immediately
+	using Image = std::vector< perm::AbstractPermutation::value_type >;
+	static_assert(!std::is_constructible_v< perm::PermutationView, Image >);
+	static_assert(!std::is_constructible_v< perm::InversePermutationView, Image >);
+	static_assert(std::is_constructible_v< perm::PermutationView, const Image & >);
+}
+
+TEST(PermutationView, libraryFunctions) {
+	const std::vector< perm::AbstractPermutation::value_type > image = { 2, 0, 1 };
+	const perm::PermutationView view(image);
+	const perm::InversePermutationView inverseView(image);
+
+	std::vector< std::string > container = { "a", "b", "c", "d" };
+	perm::applyPermutation(container, view);
+	ASSERT_EQ(container, (std::vector< std::string >{ "c", "a", "b", "d" }));
+
+	perm::applyPermutation(container, inverseView);
+	ASSERT_EQ(container, (std::vector< std::string >{ "a", "b", "c", "d" }));
+
+	const perm::PrimitivePermutationGroup group({ perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 })) });
+	ASSERT_TRUE(group.contains(view));
+	ASSERT_TRUE(group.contains(inverseView));
+	const std::vector< perm::AbstractPermutation::value_type > transposition = { 1, 0 };
+	ASSERT_FALSE(group.contains(perm::PermutationView(transposition)));
+
+	perm::ExplicitPermutation product = perm::ExplicitPermutation(perm::Cycle({ 0, 1 })) * view;
+	product.postMultiply(inverseView);
+	ASSERT_EQ(product, perm::ExplicitPermutation(perm::Cycle({ 0, 1 })));
+}
@@ -8,8 +8,12 @@
 #include <libperm/Permutation.hpp>
 #include <libperm/PrimitivePermutationGroup.hpp>
 
+#include "CountingMemoryResource.hpp"
+
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <utility>
 #include <vector>
 
 TEST(PrimitivePermutationGroup, construction) {
@@ -32,3 +36,280 @@ TEST(PrimitivePermutationGroup, construction) {
 
 	ASSERT_EQ(group, group3);
 }
+
+TEST(PrimitivePermutationGroup, relabelling) {
+	const perm::PrimitivePermutationGroup original({ perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 })),
+													 perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1) });
+
+	perm::PrimitivePermutationGroup group = original;
+	group.shift(2);
+
+	ASSERT_EQ(group, perm::PrimitivePermutationGroup({ perm::ExplicitPermutation(perm::Cycle({ 2, 3, 4 })),
+													   perm::ExplicitPermutation(perm::Cycle({ 2, 3 }), -1) }));
+	ASSERT_EQ(group.order(), 6);
+	ASSERT_TRUE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 3, 4 }), -1)));
+	ASSERT_FALSE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 3, 4 }))));
+
+	// Points 0 and 1 are fixed by all elements
+	group.removeFixedPoints({ 1, 0 });
+
+	ASSERT_EQ(group, original);
+
+	// Relabel 0 -> 3, 1 -> 1, 2 -> 4, 3 -> 0, 4 -> 2
+	const perm::ExplicitPermutation relabelling(perm::Cycle({ { 0, 3 }, { 2, 4 } }));
+	group.conjugate(relabelling);
+
+	ASSERT_EQ(group.order(), 6);
+	ASSERT_TRUE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 3, 1, 4 }))));
+	ASSERT_TRUE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 3, 1 }), -1)));
+	ASSERT_TRUE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 1, 4 }), -1)));
+	ASSERT_FALSE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1)));
+
+	group.conjugate(relabelling);
+
+	ASSERT_EQ(group, original);
+
+	std::vector< perm::Permutation > elements;
+	std::vector< perm::Permutation > originalElements;
+	group.getElementsTo(elements);
+	original.getElementsTo(originalElements);
+
+	for (const perm::Permutation &currentElement : originalElements) {
+		ASSERT_TRUE(group.contains(currentElement.get())) << "Element: " << currentElement;
+	}
+}
+
+TEST(PrimitivePermutationGroup, directProduct) {
+	const perm::PrimitivePermutationGroup lhs({ perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3, 4 })),
+												perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1) });
+	const perm::PrimitivePermutationGroup rhs({ perm::ExplicitPermutation(perm::Cycle({ 5, 6, 7, 8, 9 })),
+												perm::ExplicitPermutation(perm::Cycle({ 5, 6 })) });
+
+	const perm::PrimitivePermutationGroup product = perm::PrimitivePermutationGroup::directProduct(lhs, rhs);
+
+	std::vector< perm::Permutation > generators = lhs.getGenerators();
+	generators.insert(generators.end(), rhs.getGenerators().begin(), rhs.getGenerators().end());
+	const perm::PrimitivePermutationGroup expected(generators);
+
+	ASSERT_EQ(product.order(), 120 * 120);
+	ASSERT_EQ(product.order(), expected.order());
+	ASSERT_EQ(product, expected);
+
+	ASSERT_TRUE(product.contains(perm::ExplicitPermutation(perm::Cycle({ { 0, 4 }, { 5, 9 } }), -1)));
+	ASSERT_TRUE(product.contains(perm::ExplicitPermutation(perm::Cycle({ { 0, 1, 2 }, { 5, 9 } }))));
+	ASSERT_FALSE(product.contains(perm::ExplicitPermutation(perm::Cycle({ { 0, 1, 2 }, { 5, 9 } }), -1)));
+	ASSERT_FALSE(product.contains(perm::ExplicitPermutation(perm::Cycle({ 4, 5 }))));
+
+	// This is big enough for the product to be computed in parallel, if requested
+	ASSERT_EQ(perm::PrimitivePermutationGroup::directProduct(lhs, rhs, 4), product);
+
+	ASSERT_EQ(perm::PrimitivePermutationGroup::directProduct(lhs, {}), lhs);
+	ASSERT_EQ(perm::PrimitivePermutationGroup::directProduct({}, rhs), rhs);
+
+	// If both factors contain the negative identity, products of elements with flipped signs coincide
+	const perm::PrimitivePermutationGroup signedLhs({ perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1),
+													  perm::ExplicitPermutation(perm::Cycle({ 0, 1 })) });
+	const perm::PrimitivePermutationGroup signedRhs({ perm::ExplicitPermutation(perm::Cycle({ 2, 3 }), -1),
+													  perm::ExplicitPermutation(perm::Cycle({ 2, 3 })) });
+	const perm::PrimitivePermutationGroup signedProduct =
+		perm::PrimitivePermutationGroup::directProduct(signedLhs, signedRhs);
+	const perm::PrimitivePermutationGroup signedExpected(
+		{ perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1), perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+		  perm::ExplicitPermutation(perm::Cycle({ 2, 3 }), -1), perm::ExplicitPermutation(perm::Cycle({ 2, 3 })) });
+
+	ASSERT_EQ(signedProduct.order(), 8);
+	ASSERT_EQ(signedProduct, signedExpected);
+
+	std::vector< perm::Permutation > signedElements;
+	signedProduct.getElementsTo(signedElements);
+	for (std::size_t i = 0; i < signedElements.size(); ++i) {
+		for (std::size_t j = i + 1; j < signedElements.size(); ++j) {
+			ASSERT_NE(signedElements[i], signedElements[j]);
+		}
+	}
+}
+
+TEST(PrimitivePermutationGroup, threadCount) {
+	// Sym(8) has cosets that are big enough to be filled in parallel
+	std::vector< perm::Permutation > generators;
+	for (perm::AbstractPermutation::value_type i = 0; i + 1 < 8; ++i) {
+		generators.push_back(perm::ExplicitPermutation(perm::Cycle({ i, i + 1 })));
+	}
+
+	perm::PrimitivePermutationGroup serialGroup(generators);
+	perm::PrimitivePermutationGroup parallelGroup(generators);
+	ASSERT_EQ(serialGroup.threadCount(), 1);
+
+	parallelGroup.setThreadCount(4);
+	ASSERT_EQ(parallelGroup.threadCount(), 4);
+	ASSERT_EQ(perm::PrimitivePermutationGroup(parallelGroup).threadCount(), 4);
+
+	ASSERT_EQ(parallelGroup.order(), 40320);
+	ASSERT_EQ(parallelGroup, serialGroup);
+}
+
+TEST(PrimitivePermutationGroup, lazyMaterialization) {
+	perm::PrimitivePermutationGroup group;
+
+	const perm::ExplicitPermutation generator1(perm::Cycle({ 0, 1, 2, 3, 4, 5 }));
+	const perm::ExplicitPermutation generator2(perm::Cycle({ 0, 1 }));
+
+	// Before the elements are needed, generators added in batches are only collected
+	group.addGenerators({ generator1, generator1 });
+	group.addGenerators({ generator2 });
+	ASSERT_EQ(group.getGenerators().size(), 3);
+
+	const perm::PrimitivePermutationGroup copy = group;
+
+	// Materialize the elements of the (same) group from multiple threads at once
+	std::vector< std::size_t > orders(4, 0);
+	std::vector< std::thread > threads;
+	for (std::size_t i = 0; i < orders.size(); ++i) {
+		threads.emplace_back([&copy, &orders, i]() { orders[i] = copy.order(); });
+	}
+	for (std::thread &currentThread : threads) {
+		currentThread.join();
+	}
+
+	for (std::size_t currentOrder : orders) {
+		ASSERT_EQ(currentOrder, 720);
+	}
+
+	ASSERT_EQ(group.order(), 720);
+
+	// Once the elements are known, redundant generators are detected as such
+	ASSERT_FALSE(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 2, 5 }))));
+	ASSERT_TRUE(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 5, 6 }))));
+	ASSERT_EQ(group.order(), 5040);
+
+	group.setGenerators({ generator2 });
+	ASSERT_EQ(group.order(), 2);
+
+	// Adding individual generators detects redundant ones even if the elements haven't been generated yet
+	perm::PrimitivePermutationGroup cyclic({ generator1 });
+	ASSERT_FALSE(cyclic.addGenerator(perm::ExplicitPermutation(perm::Cycle({ { 0, 2, 4 }, { 1, 3, 5 } }))));
+	ASSERT_TRUE(cyclic.addGenerator(generator2));
+	ASSERT_EQ(cyclic.order(), 720);
+}
+
+TEST(PrimitivePermutationGroup, copyOnWrite) {
+	perm::PrimitivePermutationGroup original({ perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 })) });
+	ASSERT_EQ(original.order(), 3);
+
+	// Copies share the elements with the original until one of them is modified
+	perm::PrimitivePermutationGroup copy = original;
+	ASSERT_EQ(copy, original);
+
+	ASSERT_TRUE(copy.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 0, 1 }))));
+	ASSERT_EQ(copy.order(), 6);
+	ASSERT_EQ(original.order(), 3);
+
+	perm::PrimitivePermutationGroup shifted = original;
+	shifted.shift(2);
+	ASSERT_TRUE(shifted.contains(perm::ExplicitPermutation(perm::Cycle({ 2, 3, 4 }))));
+	ASSERT_TRUE(original.contains(perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 }))));
+	ASSERT_FALSE(original.contains(perm::ExplicitPermutation(perm::Cycle({ 2, 3, 4 }))));
+
+	perm::PrimitivePermutationGroup moved = std::move(copy);
+	ASSERT_EQ(moved.order(), 6);
+}
+
+TEST(PrimitivePermutationGroup, memoryResource) {
+	CountingMemoryResource resource;
+
+	{
+		const std::vector< perm::Permutation > generators = { perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3 })),
+															  perm::ExplicitPermutation(perm::Cycle({ 0, 1 })) };
+		const perm::PrimitivePermutationGroup reference(generators);
+		perm::PrimitivePermutationGroup group(generators, &resource);
+		ASSERT_EQ(group.resource(), &resource);
+
+		ASSERT_EQ(group.order(), 24);
+		ASSERT_EQ(group, reference);
+		const std::size_t allocations = resource.allocations();
+		ASSERT_GE(allocations, group.order());
+
+		// Cosets are allocated from the group's resource as well
+		const perm::ExplicitPermutation perm(perm::Cycle({ 3, 4 }));
+		const std::vector< perm::Permutation > coset = group.rightCoset(perm);
+		ASSERT_GE(resource.allocations(), allocations + coset.size());
+		ASSERT_EQ(coset, reference.rightCoset(perm));
+
+		// Copies of the group share the resource
+		perm::PrimitivePermutationGroup copy = group;
+		ASSERT_EQ(copy.resource(), &resource);
+		copy.shift(1);
+		ASSERT_EQ(copy.order(), 24);
+
+		const perm::PrimitivePermutationGroup other({ perm::ExplicitPermutation(perm::Cycle({ 5, 6 })) });
+		const perm::PrimitivePermutationGroup product = perm::PrimitivePermutationGroup::directProduct(group, other);
+		ASSERT_EQ(product.resource(), &resource);
+		ASSERT_EQ(product.order(), 48);
+	}
+
+	ASSERT_EQ(resource.liveAllocations(), 0);
+}
+
+TEST(PrimitivePermutationGroup, multiplicationTables) {
+	const auto multiply = [](const perm::Permutation &lhs, const perm::Permutation &rhs) {
+		perm::ExplicitPermutation product(lhs.get(), perm::ExplicitPermutation::allocator_type());
+		product.postMultiply(rhs.get());
+		return product;
+	};
+
+	perm::PrimitivePermutationGroup group({ perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3 })),
+											perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1) });
+
+	std::vector< perm::Permutation > elements;
+	group.getElementsTo(elements);
+	ASSERT_EQ(elements.size(), 48);
+
+	for (std::size_t i = 0; i < elements.size(); ++i) {
+		ASSERT_EQ(group.element(i), elements[i]);
+		ASSERT_EQ(group.indexOf(elements[i].get()), i);
+	}
+	ASSERT_EQ(group.indexOf(perm::ExplicitPermutation(perm::Cycle({ 0, 4 }))), group.order());
+
+	const perm::MultiplicationTable &generatorTable = group.generatorTable();
+	ASSERT_EQ(generatorTable.rows(), group.order());
+	ASSERT_EQ(generatorTable.columns(), group.getGenerators().size());
+
+	for (std::size_t i = 0; i < elements.size(); ++i) {
+		for (std::size_t k = 0; k < group.getGenerators().size(); ++k) {
+			ASSERT_EQ(elements[generatorTable(i, k)], multiply(elements[i], group.getGenerators()[k]));
+		}
+	}
+
+	const perm::MultiplicationTable &cayleyTable = group.cayleyTable();
+	ASSERT_EQ(cayleyTable.rows(), group.order());
+	ASSERT_EQ(cayleyTable.columns(), group.order());
+
+	for (std::size_t i = 0; i < elements.size(); ++i) {
+		for (std::size_t j = 0; j < elements.size(); ++j) {
+			ASSERT_EQ(elements[cayleyTable(i, j)], multiply(elements[i], elements[j]));
+		}
+	}
+
+	// Copies share the tables, which are rebuilt once the group has been modified
+	const perm::PrimitivePermutationGroup copy = group;
+	ASSERT_EQ(&copy.cayleyTable(), &cayleyTable);
+
+	ASSERT_TRUE(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 3, 4 }))));
+	ASSERT_EQ(group.generatorTable().rows(), group.order());
+	ASSERT_EQ(group.generatorTable().columns(), 3);
+	ASSERT_EQ(copy.generatorTable().rows(), 48);
+
+	// Computing the tables of big groups in parallel gives the same result
+	const std::vector< perm::Permutation > symmetricGenerators = {
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3, 4, 5, 6 })), perm::ExplicitPermutation(perm::Cycle({ 0, 1 }))
+	};
+	const perm::PrimitivePermutationGroup serialGroup(symmetricGenerators);
+	const perm::PrimitivePermutationGroup parallelGroup(symmetricGenerators);
+
+	ASSERT_EQ(parallelGroup.generatorTable(4).rows(), 5040);
+	for (std::size_t i = 0; i < serialGroup.order(); ++i) {
+		for (std::size_t k = 0; k < symmetricGenerators.size(); ++k) {
+			ASSERT_EQ(parallelGroup.generatorTable()(i, k), serialGroup.generatorTable()(i, k));
+		}
+	}
+}
@@ -0,0 +1,104 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/Cycle.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/Serialization.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+TEST(Serialization, singlePermutation) {
+	const std::vector< perm::ExplicitPermutation > perms = {
+		perm::ExplicitPermutation(),
+		perm::ExplicitPermutation(-1),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+		perm::ExplicitPermutation(perm::Cycle({ 3, 5, 4 }), -1),
+		perm::ExplicitPermutation(perm::Cycle({ 2, 200, 70000 })),
+	};
+
+	for (const perm::ExplicitPermutation &currentPerm : perms) {
+		std::vector< std::uint8_t > buffer;
+		perm::serialize(currentPerm, buffer);
+
+		std::size_t offset                                 = 0;
+		std::optional< perm::ExplicitPermutation > restored = perm::deserialize(buffer.data(), buffer.size(), offset);
+
+		ASSERT_TRUE(restored.has_value());
+		ASSERT_EQ(restored.value(), currentPerm);
+		ASSERT_EQ(restored->sign(), currentPerm.sign());
+		ASSERT_EQ(offset, buffer.size());
+	}
+
+	// Small permutations take up a single byte per moved point (plus one byte for size and sign)
+	std::vector< std::uint8_t > buffer;
+	perm::serialize(perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 }), -1), buffer);
+	ASSERT_EQ(buffer, std::vector< std::uint8_t >({ (3 << 1) | 1, 1, 2, 0 }));
+
+	// Trailing fixed points are not stored
+	buffer.clear();
+	perm::serialize(perm::ExplicitPermutation({ 1, 0, 2, 3 }), buffer);
+	ASSERT_EQ(buffer.size(), 3);
+}
+
+TEST(Serialization, batch) {
+	const std::vector< perm::Permutation > perms = {
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+		perm::ExplicitPermutation(),
+		perm::ExplicitPermutation(perm::Cycle({ 1, 2, 3, 4 }), -1),
+	};
+
+	std::vector< std::uint8_t > buffer = { 42 };
+	perm::serialize(perms, buffer);
+	perm::serialize(perm::ExplicitPermutation(perm::Cycle({ 0, 2 })), buffer);
+
+	std::size_t offset = 1;
+	std::vector< perm::Permutation > restored;
+	ASSERT_TRUE(perm::deserializeTo(buffer.data(), buffer.size(), offset, restored));
+	ASSERT_EQ(restored, perms);
+
+	std::optional< perm::ExplicitPermutation > last = perm::deserialize(buffer.data(), buffer.size(), offset);
+	ASSERT_TRUE(last.has_value());
+	ASSERT_EQ(last.value(), perm::ExplicitPermutation(perm::Cycle({ 0, 2 })));
+	ASSERT_EQ(offset, buffer.size());
+
+	// Truncated batches are rejected without modifying the output
+	offset = 1;
+	ASSERT_FALSE(perm::deserializeTo(buffer.data(), buffer.size() - 5, offset, restored));
+	ASSERT_EQ(offset, 1);
+	ASSERT_EQ(restored, perms);
+}
+
+TEST(Serialization, invalidData) {
+	std::size_t offset = 0;
+
+	// Image contains a point twice
+	const std::vector< std::uint8_t > duplicateImage = { 3 << 1, 1, 1, 0 };
+	ASSERT_FALSE(perm::deserialize(duplicateImage.data(), duplicateImage.size(), offset).has_value());
+
+	// Image contains a point that is out of range
+	const std::vector< std::uint8_t > outOfRange = { 2 << 1, 1, 2 };
+	ASSERT_FALSE(perm::deserialize(outOfRange.data(), outOfRange.size(), offset).has_value());
+
+	// Unterminated varint
+	const std::vector< std::uint8_t > unterminated = { 0x80, 0x80 };
+	ASSERT_FALSE(perm::deserialize(unterminated.data(), unterminated.size(), offset).has_value());
+
+	// Size that exceeds the available data
+	const std::vector< std::uint8_t > tooBig = { 0xff, 0xff, 0x03, 0 };
+	ASSERT_FALSE(perm::deserialize(tooBig.data(), tooBig.size(), offset).has_value());
+
+	ASSERT_EQ(offset, 0);
+
+	std::vector< perm::Permutation > perms;
+	const std::vector< std::uint8_t > tooManyElements = { 5, 0, 0 };
+	ASSERT_FALSE(perm::deserializeTo(tooManyElements.data(), tooManyElements.size(), offset, perms));
+	ASSERT_TRUE(perms.empty());
+}
@@ -0,0 +1,109 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/SparsePermutation.hpp>
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+using Mapping = std::vector< perm::SparsePermutation::mapping_type >;
+
+TEST(SparsePermutation, construction) {
+	perm::SparsePermutation perm;
+
+	ASSERT_EQ(perm.maxElement(), static_cast< perm::AbstractPermutation::value_type >(0));
+	ASSERT_EQ(perm.supportSize(), static_cast< std::size_t >(0));
+	ASSERT_TRUE(perm.isIdentity());
+	ASSERT_EQ(perm.sign(), 1);
+
+	perm = perm::SparsePermutation(-1);
+	ASSERT_TRUE(!perm.isIdentity());
+	ASSERT_EQ(perm.sign(), -1);
+
+	// Fixed points are dropped and the order of the entries is irrelevant
+	perm = perm::SparsePermutation(Mapping{ { 1000000, 7 }, { 3, 3 }, { 7, 1000000 } });
+	ASSERT_EQ(perm.maxElement(), static_cast< perm::AbstractPermutation::value_type >(1000000));
+	ASSERT_EQ(perm.supportSize(), static_cast< std::size_t >(2));
+	ASSERT_EQ(perm.mapping(), (Mapping{ { 7, 1000000 }, { 1000000, 7 } }));
+	ASSERT_EQ(perm.image(7), static_cast< perm::AbstractPermutation::value_type >(1000000));
+	ASSERT_EQ(perm.image(3), static_cast< perm::AbstractPermutation::value_type >(3));
+	ASSERT_EQ(perm.image(2000000), static_cast< perm::AbstractPermutation::value_type >(2000000));
+
+	perm = perm::SparsePermutation(perm::Cycle({ 0, 1, 2, 3 }));
+	ASSERT_EQ(perm.mapping(), (Mapping{ { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 } }));
+
+	const perm::ExplicitPermutation explicitPerm(perm::Cycle({ { 2, 5 }, { 8, 9 } }), -1);
+	perm = perm::SparsePermutation(explicitPerm);
+	ASSERT_EQ(perm.mapping(), (Mapping{ { 2, 5 }, { 5, 2 }, { 8, 9 }, { 9, 8 } }));
+	ASSERT_EQ(perm.sign(), -1);
+	ASSERT_EQ(perm, explicitPerm);
+	ASSERT_EQ(explicitPerm, perm);
+}
+
+TEST(SparsePermutation, multiply) {
+	const perm::SparsePermutation p1(perm::Cycle({ 100, 5000 }));
+	const perm::SparsePermutation p2(perm::Cycle({ 5000, 70000 }), -1);
+
+	// Apply p1 first, then p2
+	perm::SparsePermutation product = p1;
+	product.postMultiply(p2);
+	ASSERT_EQ(product, perm::SparsePermutation(perm::Cycle({ 100, 70000, 5000 }), -1));
+	ASSERT_EQ(product.supportSize(), static_cast< std::size_t >(3));
+
+	// Apply p2 first, then p1
+	product = p1;
+	product.preMultiply(p2);
+	ASSERT_EQ(product, perm::SparsePermutation(perm::Cycle({ 100, 5000, 70000 }), -1));
+
+	// Mixed representations
+	product = p1;
+	product.postMultiply(perm::ExplicitPermutation(perm::Cycle({ 2, 3 })));
+	ASSERT_EQ(product, perm::SparsePermutation(perm::Cycle({ { 2, 3 }, { 100, 5000 } })));
+
+	product.postMultiply(product);
+	ASSERT_TRUE(product.isIdentity());
+	ASSERT_EQ(product.supportSize(), static_cast< std::size_t >(0));
+}
+
+TEST(SparsePermutation, invert) {
+	perm::SparsePermutation perm(perm::Cycle({ { 4, 90, 12 }, { 1, 3 } }), -1);
+
+	perm.invert();
+
+	ASSERT_EQ(perm, perm::SparsePermutation(perm::Cycle({ { 12, 90, 4 }, { 1, 3 } }), -1));
+	ASSERT_EQ(perm.mapping(), (Mapping{ { 1, 3 }, { 3, 1 }, { 4, 12 }, { 12, 90 }, { 90, 4 } }));
+}
+
+TEST(SparsePermutation, shift) {
+	perm::SparsePermutation perm(perm::Cycle({ { 1, 3 }, { 10, 20 } }));
+
+	perm.shift(5, 4);
+	ASSERT_EQ(perm, perm::SparsePermutation(perm::Cycle({ { 1, 3 }, { 15, 25 } })));
+
+	perm.shift(-1);
+	ASSERT_EQ(perm, perm::SparsePermutation(perm::Cycle({ { 0, 2 }, { 14, 24 } })));
+}
+
+TEST(SparsePermutation, toCycle) {
+	const perm::Cycle cycle({ { 3, 400, 7 }, { 8, 9 } });
+	const perm::SparsePermutation perm(cycle);
+
+	ASSERT_EQ(perm.toCycle(), cycle);
+	ASSERT_EQ(perm.toString(), "+( 3 400 7 )( 8 9 )");
+}
+
+TEST(SparsePermutation, variant) {
+	perm::Permutation perm = perm::SparsePermutation(perm::Cycle({ 6, 600 }));
+
+	perm->postMultiply(perm::ExplicitPermutation(perm::Cycle({ 6, 600 })));
+	ASSERT_TRUE(perm->isIdentity());
+
+	ASSERT_EQ(std::hash< perm::Permutation >{}(perm), std::hash< perm::Permutation >{}(perm::ExplicitPermutation()));
+}
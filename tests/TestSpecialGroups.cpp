@@ -3,13 +3,19 @@
 // LICENSE file at the root of the libPerm source tree or at
 // <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
 
+#include <libperm/CyclicGroup.hpp>
+#include <libperm/DihedralGroup.hpp>
 #include <libperm/ExplicitPermutation.hpp>
 #include <libperm/PrimitivePermutationGroup.hpp>
 #include <libperm/SpecialGroups.hpp>
+#include <libperm/YoungSubgroup.hpp>
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <stdexcept>
+#include <vector>
 
 
 std::size_t factorial(unsigned int num) {
@@ -31,7 +37,8 @@ template< typename G, typename P > struct TypeHolder {
 template< typename T > struct SpecialGroupsTest : ::testing::Test {};
 
 
-using Types = ::testing::Types< TypeHolder< perm::PrimitivePermutationGroup, perm::ExplicitPermutation > >;
+using Types = ::testing::Types< TypeHolder< perm::PrimitivePermutationGroup, perm::ExplicitPermutation >,
+								TypeHolder< perm::YoungSubgroup, perm::ExplicitPermutation > >;
 TYPED_TEST_SUITE(SpecialGroupsTest, Types, );
 
 
@@ -117,3 +124,84 @@ TYPED_TEST(SpecialGroupsTest, antisymmetricRanges) {
 	actualGroup = perm::antisymmetricRanges< Group, Perm >({ { 1, 3 }, { 5, 6 } });
 	ASSERT_EQ(actualGroup, expectedGroup);
 }
+
+
+template< typename Group >
+void compareWithPrimitiveGroup(const Group &group, const perm::PrimitivePermutationGroup &primitive) {
+	// Permutations acting on points both on and beyond the rings used in the tests
+	const std::vector< perm::ExplicitPermutation > cosetGenerators = {
+		perm::ExplicitPermutation(),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+		perm::ExplicitPermutation(perm::Cycle({ 2, 4, 1 }), -1),
+		perm::ExplicitPermutation(perm::Cycle({ { 0, 3 }, { 1, 5, 6 } })),
+		perm::ExplicitPermutation(perm::Cycle({ 0, 6, 2, 5, 3 })),
+		perm::ExplicitPermutation(perm::Cycle({ { 1, 3 }, { 2, 4 } })),
+	};
+
+	ASSERT_EQ(group.order(), primitive.order());
+	ASSERT_EQ(group, primitive);
+
+	std::vector< perm::Permutation > elements;
+	std::vector< perm::Permutation > primitiveElements;
+	group.getElementsTo(elements);
+	primitive.getElementsTo(primitiveElements);
+
+	ASSERT_THAT(elements, ::testing::UnorderedElementsAreArray(primitiveElements));
+
+	for (perm::AbstractPermutation::value_type i = 0; i < 7; ++i) {
+		ASSERT_THAT(group.orbit(i), ::testing::UnorderedElementsAreArray(primitive.orbit(i)));
+	}
+
+	// The ranks of the elements of ring groups follow the order of getElementsTo
+	for (std::size_t i = 0; i < elements.size(); ++i) {
+		ASSERT_EQ(group.rank(elements[i].get()), i);
+		ASSERT_EQ(group.unrank(i), elements[i]);
+	}
+
+	for (const perm::ExplicitPermutation &currentPerm : cosetGenerators) {
+		ASSERT_EQ(group.contains(currentPerm), primitive.contains(currentPerm)) << "Perm: " << currentPerm;
+		ASSERT_EQ(group.rank(currentPerm) != group.order(), primitive.contains(currentPerm)) << "Perm: " << currentPerm;
+
+		ASSERT_EQ(group.leftCosetRepresentative(currentPerm), primitive.leftCosetRepresentative(currentPerm))
+			<< "Coset generator: " << currentPerm;
+		ASSERT_EQ(group.rightCosetRepresentative(currentPerm), primitive.rightCosetRepresentative(currentPerm))
+			<< "Coset generator: " << currentPerm;
+	}
+}
+
+TEST(SpecialGroups, Cyclic) {
+	for (unsigned int n : { 0, 1, 2, 3, 4, 5 }) {
+		const perm::CyclicGroup group = perm::Cyclic(n);
+
+		ASSERT_EQ(group.order(), n == 0 ? 1 : n);
+
+		compareWithPrimitiveGroup(group, perm::Cyclic< perm::PrimitivePermutationGroup >(n));
+	}
+}
+
+TEST(SpecialGroups, Dihedral) {
+	for (unsigned int n : { 0, 1, 2, 3, 4, 5 }) {
+		const perm::DihedralGroup group = perm::Dihedral(n);
+
+		ASSERT_EQ(group.order(), n <= 2 ? std::max(n, 1u) : 2 * n);
+
+		compareWithPrimitiveGroup(group, perm::Dihedral< perm::PrimitivePermutationGroup >(n));
+	}
+}
+
+TEST(SpecialGroups, fixedRingGenerators) {
+	perm::DihedralGroup group = perm::Dihedral(4);
+
+	// Elements of the group are accepted but don't change it
+	ASSERT_FALSE(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 0, 2 }))));
+	group.setGenerators({ perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3 })) });
+	ASSERT_EQ(group.order(), 8);
+
+	ASSERT_THROW(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 0, 1 }))), std::invalid_argument);
+	ASSERT_THROW(group.setGenerators({ perm::ExplicitPermutation(perm::Cycle({ 0, 1 })) }), std::invalid_argument);
+	ASSERT_EQ(group.order(), 8);
+
+	perm::CyclicGroup cyclic = perm::Cyclic(4);
+	ASSERT_THROW(cyclic.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 0, 2 }))), std::invalid_argument);
+	ASSERT_EQ(cyclic.order(), 4);
+}
@@ -0,0 +1,74 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/Cycle.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/StaticPermutation.hpp>
+#include <libperm/Utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+
+using StaticPerm = perm::StaticPermutation< 5 >;
+
+// All operations can be evaluated by the compiler
+static_assert(StaticPerm().isIdentity());
+static_assert(!StaticPerm(-1).isIdentity());
+static_assert(StaticPerm::fromCycles({ { 0, 1, 2 } }).image(2) == 0);
+static_assert(StaticPerm::fromCycles({ { 0, 1, 2 } }).image(7) == 7);
+static_assert(StaticPerm::fromCycles({ { 0, 1, 2 } }).inverse() == StaticPerm::fromCycles({ { 2, 1, 0 } }));
+static_assert((StaticPerm::fromCycles({ { 0, 1 } }, -1) * StaticPerm::fromCycles({ { 0, 1 } }, -1)).isIdentity());
+static_assert(StaticPerm() < StaticPerm::fromCycles({ { 0, 1 } }));
+
+TEST(StaticPermutation, construction) {
+	constexpr StaticPerm identity;
+	ASSERT_TRUE(identity.isIdentity());
+	ASSERT_EQ(identity.sign(), 1);
+	ASSERT_EQ(identity.images(), (StaticPerm::image_type{ 0, 1, 2, 3, 4 }));
+
+	constexpr StaticPerm perm = StaticPerm::fromCycles({ { 0, 3 }, { 1, 4, 2 } }, -1);
+	ASSERT_EQ(perm.images(), (StaticPerm::image_type{ 3, 4, 1, 0, 2 }));
+	ASSERT_EQ(perm.sign(), -1);
+	ASSERT_EQ(perm, StaticPerm(StaticPerm::image_type{ 3, 4, 1, 0, 2 }, -1));
+	ASSERT_NE(perm, StaticPerm(StaticPerm::image_type{ 3, 4, 1, 0, 2 }));
+}
+
+TEST(StaticPermutation, multiply) {
+	constexpr StaticPerm p1 = StaticPerm::fromCycles({ { 0, 2, 3 } });
+	constexpr StaticPerm p2 = StaticPerm::fromCycles({ { 1, 2, 4 } }, -1);
+
+	const perm::ExplicitPermutation explicit1(perm::Cycle({ 0, 2, 3 }));
+	const perm::ExplicitPermutation explicit2(perm::Cycle({ 1, 2, 4 }), -1);
+
+	// Apply p1 first, then p2
+	StaticPerm product = p1;
+	product.postMultiply(p2);
+	ASSERT_EQ(product, p1 * p2);
+	ASSERT_EQ(product.view(), explicit1 * explicit2);
+
+	// Apply p2 first, then p1
+	product = p1;
+	product.preMultiply(p2);
+	ASSERT_EQ(product.view(), explicit2 * explicit1);
+
+	perm::ExplicitPermutation inverse = explicit2 * explicit1;
+	inverse.invert();
+	product.invert();
+	ASSERT_EQ(product.view(), inverse);
+	ASSERT_EQ(product, (p2 * p1).inverse());
+}
+
+TEST(StaticPermutation, view) {
+	constexpr StaticPerm perm = StaticPerm::fromCycles({ { 0, 3 }, { 1, 4, 2 } }, -1);
+
+	ASSERT_EQ(perm.view(), perm::ExplicitPermutation(perm::Cycle({ { 0, 3 }, { 1, 4, 2 } }), -1));
+	ASSERT_EQ(perm.view().maxElement(), static_cast< perm::AbstractPermutation::value_type >(4));
+
+	std::array< std::string, 5 > sequence = { "a", "b", "c", "d", "e" };
+	perm::applyPermutation(sequence, perm.view());
+	ASSERT_EQ(sequence, (std::array< std::string, 5 >{ "d", "e", "b", "a", "c" }));
+}
@@ -0,0 +1,88 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/Cycle.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/PrimitivePermutationGroup.hpp>
+#include <libperm/StaticPermutation.hpp>
+#include <libperm/StaticPermutationGroup.hpp>
+#include <libperm/Utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+using StaticPerm = perm::StaticPermutation< 4 >;
+
+/**
+ * The index symmetries of the Riemann tensor R_{abcd}: antisymmetric in (a,b) and in (c,d) and symmetric under the
+ * exchange of these pairs
+ */
+struct RiemannSymmetry {
+	static constexpr std::array< StaticPerm, 3 > generators = {
+		StaticPerm::fromCycles({ { 0, 1 } }, -1),
+		StaticPerm::fromCycles({ { 2, 3 } }, -1),
+		StaticPerm::fromCycles({ { 0, 2 }, { 1, 3 } }),
+	};
+};
+
+struct CyclicSymmetry {
+	static constexpr std::array< StaticPerm, 1 > generators = { StaticPerm::fromCycles({ { 0, 1, 2, 3 } }) };
+};
+
+struct SymmetricGroup {
+	static constexpr std::array< StaticPerm, 2 > generators = { StaticPerm::fromCycles({ { 0, 1, 2, 3 } }),
+																 StaticPerm::fromCycles({ { 0, 1 } }) };
+};
+
+// The groups are enumerated at compile time
+static_assert(perm::staticGroup< RiemannSymmetry >.order() == 8);
+static_assert(perm::staticGroup< CyclicSymmetry >.order() == 4);
+static_assert(perm::staticGroup< SymmetricGroup >.order() == 24);
+static_assert(perm::staticGroup< RiemannSymmetry >.elements()[0].isIdentity());
+static_assert(perm::staticGroup< RiemannSymmetry >.contains(StaticPerm::fromCycles({ { 0, 3 }, { 1, 2 } })));
+static_assert(!perm::staticGroup< RiemannSymmetry >.contains(StaticPerm::fromCycles({ { 0, 2 } })));
+
+TEST(StaticPermutationGroup, generation) {
+	constexpr const auto &group = perm::staticGroup< RiemannSymmetry >;
+
+	std::vector< perm::Permutation > generators;
+	for (const StaticPerm &current : RiemannSymmetry::generators) {
+		generators.push_back(perm::ExplicitPermutation(current.view().toCycle(), current.sign()));
+	}
+	const perm::PrimitivePermutationGroup reference(generators);
+
+	ASSERT_EQ(group.order(), reference.order());
+
+	for (const StaticPerm &current : group) {
+		ASSERT_TRUE(reference.contains(current.view())) << current.view();
+	}
+}
+
+TEST(StaticPermutationGroup, canonicalize) {
+	constexpr const auto &group = perm::staticGroup< RiemannSymmetry >;
+
+	const std::array< std::string, 4 > reference = { "d", "b", "a", "c" };
+
+	std::array< std::string, 4 > canonical = reference;
+	const int referenceSign                = group.canonicalize(canonical);
+	ASSERT_EQ(canonical, (std::array< std::string, 4 >{ "a", "c", "b", "d" }));
+
+	// All sequences that are related to the reference by a group element have the same canonical form
+	for (const StaticPerm &current : group) {
+		std::array< std::string, 4 > sequence = reference;
+		perm::applyPermutation(sequence, current.view());
+
+		const StaticPerm &canonicalizer = group.computeCanonicalizationPermutation(sequence.begin(), sequence.end());
+		ASSERT_TRUE(group.contains(canonicalizer));
+
+		const int sign = group.canonicalize(sequence.begin(), sequence.end());
+		ASSERT_EQ(sequence, canonical) << current.view();
+		ASSERT_EQ(sign, canonicalizer.sign());
+		ASSERT_EQ(sign * current.sign(), referenceSign) << current.view();
+	}
+}
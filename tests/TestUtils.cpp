@@ -5,6 +5,7 @@
 
 #include "libperm/AbstractPermutation.hpp"
 #include "libperm/Cycle.hpp"
+#include "libperm/DirectProductGroup.hpp"
 #include "libperm/ExplicitPermutation.hpp"
 #include "libperm/PrimitivePermutationGroup.hpp"
 #include "libperm/Utils.hpp"
@@ -18,6 +19,7 @@
 #include <functional>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 perm::PrimitivePermutationGroup asGroup(const std::vector< perm::Cycle > &generators) {
@@ -30,6 +32,16 @@ perm::PrimitivePermutationGroup asGroup(const std::vector< perm::Cycle > &genera
 	return group;
 }
 
+perm::PrimitivePermutationGroup asSignedGroup(const std::vector< std::pair< perm::Cycle, int > > &generators) {
+	perm::PrimitivePermutationGroup group;
+
+	for (const std::pair< perm::Cycle, int > &currentGenerator : generators) {
+		group.addGenerator(perm::ExplicitPermutation(currentGenerator.first, currentGenerator.second));
+	}
+
+	return group;
+}
+
 
 TEST(Utils, applyPermutation) {
 	// A few manual, hard-coded examples
@@ -89,7 +101,7 @@ TEST(Utils, applyPermutation_consistency) {
 
 	perm::applyPermutation(sequence, perm);
 
-	ASSERT_EQ(sequence, perm.image());
+	ASSERT_TRUE(std::equal(sequence.begin(), sequence.end(), perm.image().begin(), perm.image().end()));
 }
 
 struct UtilsTest : testing::TestWithParam< std::vector< perm::AbstractPermutation::value_type > > {
@@ -459,6 +471,23 @@ TEST_P(ConcatenateTest, concatenate) {
 		lhsGroup, remainingLeftSize, rhsGroup, lhsExcludes, rhsExcludes);
 
 	ASSERT_EQ(actualGroup, expectedGroup);
+
+	perm::DirectProductGroup actualProduct = perm::concatenate< perm::DirectProductGroup >(
+		lhsGroup, remainingLeftSize, rhsGroup, lhsExcludes, rhsExcludes);
+
+	ASSERT_EQ(actualProduct, expectedGroup);
+
+	perm::DirectProductGroup chainedProduct =
+		perm::concatenate< perm::DirectProductGroup >(actualProduct, 20, actualProduct);
+
+	if (expectedGroup.contains(perm::ExplicitPermutation(-1))) {
+		// Both copies contain the negative identity, which they share in the product
+		ASSERT_EQ(chainedProduct.order(), expectedGroup.order() * expectedGroup.order() / 2);
+	} else {
+		// Chained concatenation keeps the individual factors
+		ASSERT_EQ(chainedProduct.order(), expectedGroup.order() * expectedGroup.order());
+		ASSERT_EQ(chainedProduct.getFactors().size(), 2 * actualProduct.getFactors().size());
+	}
 }
 
 // clang-format off
@@ -494,6 +523,14 @@ INSTANTIATE_TEST_SUITE_P(
 			asGroup({perm::Cycle({2,3}), perm::Cycle({3,4})}),
 			{0,1,5},
 			asGroup({perm::Cycle({0,3,4}), perm::Cycle({3,4}), perm::Cycle({6,7}), perm::Cycle({7,8})})
+		},
+		ConcatenateTest::ParamPack{
+			asSignedGroup({{perm::Cycle({0,1}), -1}, {perm::Cycle({0,1}), 1}}),
+			{},
+			asSignedGroup({{perm::Cycle({0,1}), -1}, {perm::Cycle({0,1}), 1}}),
+			{},
+			asSignedGroup({{perm::Cycle({0,1}), -1}, {perm::Cycle({0,1}), 1},
+						   {perm::Cycle({8,9}), -1}, {perm::Cycle({8,9}), 1}})
 		}
 	));
 // clang-format on
@@ -0,0 +1,180 @@
+// This file is part of libPerm. Use of this source code is
+// governed by a BSD-style license that can be found in the
+// LICENSE file at the root of the libPerm source tree or at
+// <https://github.com/Krzmbrzl/libPerm/blob/develop/LICENSE>.
+
+#include <libperm/Cycle.hpp>
+#include <libperm/ExplicitPermutation.hpp>
+#include <libperm/Permutation.hpp>
+#include <libperm/PrimitivePermutationGroup.hpp>
+#include <libperm/YoungSubgroup.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+
+// Permutations of the points 0..6 used to generate cosets
+const std::vector< perm::ExplicitPermutation > cosetGenerators = {
+	perm::ExplicitPermutation(),
+	perm::ExplicitPermutation(perm::Cycle({ 0, 4 })),
+	perm::ExplicitPermutation(perm::Cycle({ 2, 6, 5 }), -1),
+	perm::ExplicitPermutation(perm::Cycle({ { 0, 3 }, { 1, 5, 6 } })),
+	perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2, 3, 4, 5, 6 }), -1),
+	perm::ExplicitPermutation(perm::Cycle({ { 1, 6 }, { 2, 4 } })),
+};
+
+
+TEST(YoungSubgroup, construction) {
+	perm::YoungSubgroup group;
+
+	ASSERT_EQ(group.order(), 1);
+	ASSERT_EQ(group.type(), perm::PermutationGroupType::Young);
+
+	group = perm::YoungSubgroup({ { 0, 2 }, { 4, 5 } });
+	ASSERT_EQ(group.order(), 6 * 2);
+
+	perm::YoungSubgroup fromGenerators({ perm::ExplicitPermutation(perm::Cycle({ 0, 1 })),
+										 perm::ExplicitPermutation(perm::Cycle({ 5, 4 })),
+										 perm::ExplicitPermutation(perm::Cycle({ 2, 1 })) });
+	ASSERT_EQ(group, fromGenerators);
+
+	// Transpositions may also join non-adjacent points
+	group = perm::YoungSubgroup({ perm::ExplicitPermutation(perm::Cycle({ 0, 3 }), -1),
+								  perm::ExplicitPermutation(perm::Cycle({ 6, 3 }), -1) });
+	ASSERT_EQ(group.order(), 6);
+	ASSERT_TRUE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 0, 6 }), -1)));
+	ASSERT_TRUE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 0, 3, 6 }))));
+	ASSERT_FALSE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 0, 6 }))));
+	ASSERT_FALSE(group.contains(perm::ExplicitPermutation(perm::Cycle({ 0, 1 }), -1)));
+}
+
+TEST(YoungSubgroup, invalidGenerators) {
+	perm::YoungSubgroup group({ { 0, 2 } });
+
+	// Generators that are not transpositions
+	ASSERT_THROW(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 3, 4, 5 }))), std::invalid_argument);
+	ASSERT_THROW(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ { 3, 4 }, { 5, 6 } }))),
+				 std::invalid_argument);
+	// Generator whose sign doesn't match the symmetry of the block
+	ASSERT_THROW(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 2, 3 }), -1)), std::invalid_argument);
+	ASSERT_EQ(group, perm::YoungSubgroup({ { 0, 2 } }));
+
+	// Elements of the group are accepted even if they are no transpositions
+	ASSERT_FALSE(group.addGenerator(perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 }))));
+
+	ASSERT_THROW(group.setGenerators({ perm::ExplicitPermutation(perm::Cycle({ 4, 5 })),
+									   perm::ExplicitPermutation(perm::Cycle({ 4, 5, 6 })) }),
+				 std::invalid_argument);
+	ASSERT_EQ(group, perm::YoungSubgroup({ { 0, 2 } }));
+}
+
+TEST(YoungSubgroup, orderOverflow) {
+	// 20! is the biggest factorial that fits into 64 bits
+	ASSERT_EQ(perm::YoungSubgroup({ { 0, 19 } }).order(), 2432902008176640000u);
+	ASSERT_EQ(perm::YoungSubgroup({ { 0, 19 }, { 20, 22 } }).order(), 6 * 2432902008176640000u);
+
+	const perm::YoungSubgroup bigBlock({ { 0, 20 } });
+	ASSERT_THROW(bigBlock.order(), std::overflow_error);
+	ASSERT_THROW(bigBlock.rank(perm::ExplicitPermutation(perm::Cycle({ 0, 20 }))), std::overflow_error);
+
+	const perm::YoungSubgroup bigProduct({ { 0, 19 }, { 20, 23 } });
+	ASSERT_THROW(bigProduct.order(), std::overflow_error);
+	ASSERT_THROW(bigProduct.rank(perm::ExplicitPermutation(perm::Cycle({ 20, 21 }))), std::overflow_error);
+
+	// Queries that don't depend on the order still work
+	ASSERT_TRUE(bigBlock.contains(perm::ExplicitPermutation(perm::Cycle({ 0, 20 }))));
+}
+
+TEST(YoungSubgroup, orbit) {
+	const perm::YoungSubgroup group({ { 1, 3 }, { 5, 6 } });
+
+	std::vector< perm::AbstractPermutation::value_type > expectedOrbit = { 0 };
+	ASSERT_EQ(group.orbit(0), expectedOrbit);
+
+	expectedOrbit = { 1, 2, 3 };
+	ASSERT_EQ(group.orbit(2), expectedOrbit);
+
+	expectedOrbit = { 5, 6 };
+	ASSERT_EQ(group.orbit(6), expectedOrbit);
+
+	expectedOrbit = { 42 };
+	ASSERT_EQ(group.orbit(42), expectedOrbit);
+}
+
+TEST(YoungSubgroup, consistentWithPrimitiveGroup) {
+	for (bool antisymmetric : { false, true }) {
+		const perm::YoungSubgroup young({ { 0, 2 }, { 4, 6 } }, antisymmetric);
+		const perm::PrimitivePermutationGroup primitive(young.getGenerators());
+
+		ASSERT_EQ(young.order(), primitive.order());
+		ASSERT_EQ(young, primitive);
+
+		std::vector< perm::Permutation > youngElements;
+		std::vector< perm::Permutation > primitiveElements;
+		young.getElementsTo(youngElements);
+		primitive.getElementsTo(primitiveElements);
+
+		ASSERT_THAT(youngElements, ::testing::UnorderedElementsAreArray(primitiveElements));
+
+		for (const perm::Permutation &currentElement : primitiveElements) {
+			ASSERT_TRUE(young.contains(currentElement));
+		}
+
+		for (const perm::ExplicitPermutation &currentPerm : cosetGenerators) {
+			ASSERT_EQ(young.contains(currentPerm), primitive.contains(currentPerm)) << "Perm: " << currentPerm;
+
+			ASSERT_EQ(young.leftCosetRepresentative(currentPerm), primitive.leftCosetRepresentative(currentPerm))
+				<< "Coset generator: " << currentPerm;
+			ASSERT_EQ(young.leftCosetRepresentative(currentPerm)->sign(),
+					  primitive.leftCosetRepresentative(currentPerm)->sign())
+				<< "Coset generator: " << currentPerm;
+
+			ASSERT_EQ(young.rightCosetRepresentative(currentPerm), primitive.rightCosetRepresentative(currentPerm))
+				<< "Coset generator: " << currentPerm;
+			ASSERT_EQ(young.rightCosetRepresentative(currentPerm)->sign(),
+					  primitive.rightCosetRepresentative(currentPerm)->sign())
+				<< "Coset generator: " << currentPerm;
+
+			EXPECT_THAT(young.leftCoset(currentPerm),
+						::testing::UnorderedElementsAreArray(primitive.leftCoset(currentPerm)));
+			EXPECT_THAT(young.rightCoset(currentPerm),
+						::testing::UnorderedElementsAreArray(primitive.rightCoset(currentPerm)));
+		}
+	}
+}
+
+TEST(YoungSubgroup, rank) {
+	// Within a single block, the ranks enumerate the arrangements in lexicographic order (Lehmer codes)
+	const perm::YoungSubgroup sym({ { 0, 2 } });
+	ASSERT_EQ(sym.rank(perm::ExplicitPermutation()), 0);
+	ASSERT_EQ(sym.rank(perm::ExplicitPermutation(perm::Cycle({ 1, 2 }))), 1);
+	ASSERT_EQ(sym.rank(perm::ExplicitPermutation(perm::Cycle({ 0, 2 }))), 5);
+	ASSERT_EQ(sym.unrank(3), perm::ExplicitPermutation(perm::Cycle({ 0, 1, 2 })));
+
+	for (bool antisymmetric : { false, true }) {
+		const perm::YoungSubgroup group({ { 0, 2 }, { 4, 7 } }, antisymmetric);
+
+		std::vector< perm::Permutation > elements;
+		group.getElementsTo(elements);
+
+		std::vector< bool > seen(group.order(), false);
+		for (const perm::Permutation &currentElement : elements) {
+			const std::size_t rank = group.rank(currentElement.get());
+
+			ASSERT_LT(rank, group.order()) << "Element: " << currentElement;
+			ASSERT_FALSE(seen[rank]) << "Element: " << currentElement;
+			seen[rank] = true;
+
+			const perm::Permutation decoded = group.unrank(rank);
+			ASSERT_EQ(decoded, currentElement);
+			ASSERT_EQ(decoded->sign(), currentElement->sign());
+		}
+
+		for (const perm::ExplicitPermutation &currentPerm : cosetGenerators) {
+			ASSERT_EQ(group.rank(currentPerm) != group.order(), group.contains(currentPerm)) << "Perm: " << currentPerm;
+		}
+	}
+}